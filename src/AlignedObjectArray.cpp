@@ -15,6 +15,7 @@
 #include "DbvtBroadphase.h"
 #endif
 #ifndef DISABLE_SOFTBODY
+#include "DefaultSoftBodySolver.h"
 #include "SoftBody.h"
 using namespace BulletSharp::SoftBody;
 #endif
@@ -22,6 +23,21 @@ using namespace BulletSharp::SoftBody;
 #include "WheelInfo.h"
 #endif
 
+static void CheckCopyRange(int index, Array^ array, int arrayIndex, int count, int size)
+{
+	if (array == nullptr)
+		throw gcnew ArgumentNullException("array");
+
+	if (count < 0)
+		throw gcnew ArgumentOutOfRangeException("count");
+
+	if (index < 0 || index > size - count)
+		throw gcnew ArgumentOutOfRangeException("index");
+
+	if (arrayIndex < 0 || arrayIndex > array->Length - count)
+		throw gcnew ArgumentOutOfRangeException("arrayIndex");
+}
+
 generic<class T>
 AlignedObjectArray<T>::AlignedObjectArray(void* alignedObjectArray, bool ownsObject)
 {
@@ -54,7 +70,13 @@ AlignedObjectArray<T>::~AlignedObjectArray()
 }
 
 generic<class T>
-System::Collections::IEnumerator^ AlignedObjectArray<T>::GetEnumerator()
+ListValueEnumerator<T> AlignedObjectArray<T>::GetEnumerator()
+{
+	return ListValueEnumerator<T>(this);
+}
+
+generic<class T>
+System::Collections::IEnumerator^ AlignedObjectArray<T>::GetObjectEnumerator()
 {
 	return gcnew ListEnumerator<T>(this);
 }
@@ -433,29 +455,12 @@ AlignedCollisionObjectArray::AlignedCollisionObjectArray(btCollisionObjectArray*
 	{
 		_collisionWorld = collisionWorld;
 		_backingList = gcnew List<CollisionObject^>();
-	}
-}
-
-void SetBodyBroadphaseHandle(CollisionObject^ item, btBroadphaseInterface* broadphase)
-{
-#ifndef DISABLE_DBVT
-	if (dynamic_cast<btDbvtBroadphase*>(broadphase)) {
-		item->BroadphaseHandle = gcnew DbvtProxy((btDbvtProxy*)item->_native->getBroadphaseHandle());
-	}
-	else
-#endif
-	// TODO: implement AxisSweep3::Handle
-	/*
-	if (dynamic_cast<btAxisSweep3*>(broadphase)) {
-		item->BroadphaseHandle = gcnew BroadphaseProxy(item->_native->getBroadphaseHandle());
-	}
-	else if (dynamic_cast<bt32BitAxisSweep3*>(broadphase)) {
-		item->BroadphaseHandle = gcnew BroadphaseProxy(item->_native->getBroadphaseHandle());
-	}*/
-	if (dynamic_cast<btSimpleBroadphase*>(broadphase)) {
-		item->BroadphaseHandle = gcnew SimpleBroadphaseProxy((btSimpleBroadphaseProxy*)item->_native->getBroadphaseHandle());
-	} else {
-		item->BroadphaseHandle = gcnew BroadphaseProxy(item->_native->getBroadphaseHandle());
+		_handleObjects = gcnew List<CollisionObject^>();
+		_handleObjects->Add(nullptr);
+		_handleGenerations = gcnew List<int>();
+		_handleGenerations->Add(0);
+		_freeHandles = gcnew Queue<int>();
+		_worldIndexHandles = gcnew List<int>();
 	}
 }
 
@@ -480,13 +485,15 @@ void AlignedCollisionObjectArray::Add(CollisionObject^ item)
 			_collisionWorld->addCollisionObject(item->_native);
         }
 
-		SetBodyBroadphaseHandle(item, _collisionWorld->getBroadphase());
+		item->_broadphase = _collisionWorld->getBroadphase();
 		_backingList->Add(item);
+		AddHandle(item);
 	}
 	else
 	{
 		Native->push_back(item->UnmanagedPointer);
 	}
+	_version++;
 }
 
 void AlignedCollisionObjectArray::Add(CollisionObject^ item, short collisionFilterGroup, short collisionFilterMask)
@@ -508,22 +515,183 @@ void AlignedCollisionObjectArray::Add(CollisionObject^ item, short collisionFilt
 		_collisionWorld->addCollisionObject(item->_native, collisionFilterGroup, collisionFilterMask);
     }
 
-	SetBodyBroadphaseHandle(item, _collisionWorld->getBroadphase());
+	item->_broadphase = _collisionWorld->getBroadphase();
 	_backingList->Add(item);
+	AddHandle(item);
+	_version++;
+}
+
+#pragma managed(push, off)
+void AlignedCollisionObjectArray_AddRange(btCollisionWorld* world, btCollisionObject** objects,
+	const short* collisionFilterGroups, const short* collisionFilterMasks, int count)
+{
+#ifndef DISABLE_DBVT
+	btDbvtBroadphase* dbvtBroadphase = dynamic_cast<btDbvtBroadphase*>(world->getBroadphase());
+	int numLeaves = dbvtBroadphase ? dbvtBroadphase->m_sets[0].m_leaves + dbvtBroadphase->m_sets[1].m_leaves : 0;
+#endif
+
+	for (int i = 0; i < count; i++)
+	{
+		btCollisionObject* object = objects[i];
+		btRigidBody* body = btRigidBody::upcast(object);
+		if (body)
+		{
+			if (collisionFilterGroups)
+				static_cast<btDynamicsWorld*>(world)->addRigidBody(body, collisionFilterGroups[i], collisionFilterMasks[i]);
+			else
+				static_cast<btDynamicsWorld*>(world)->addRigidBody(body);
+			continue;
+		}
+#ifndef DISABLE_SOFTBODY
+		btSoftBody* softBody = btSoftBody::upcast(object);
+		if (softBody)
+		{
+			if (collisionFilterGroups)
+				static_cast<btSoftRigidDynamicsWorld*>(world)->addSoftBody(softBody, collisionFilterGroups[i], collisionFilterMasks[i]);
+			else
+				static_cast<btSoftRigidDynamicsWorld*>(world)->addSoftBody(softBody);
+			continue;
+		}
+#endif
+		if (collisionFilterGroups)
+			world->addCollisionObject(object, collisionFilterGroups[i], collisionFilterMasks[i]);
+		else
+			world->addCollisionObject(object);
+	}
+
+#ifndef DISABLE_DBVT
+	// A top-down rebuild costs as much as the whole tree, so it only pays off
+	// when the batch at least doubled the number of leaves
+	if (dbvtBroadphase && count >= numLeaves)
+	{
+		dbvtBroadphase->optimize();
+	}
+#endif
+}
+#pragma managed(pop)
+
+void AlignedCollisionObjectArray::AddRange(array<CollisionObject^>^ items, array<short>^ collisionFilterGroups,
+	array<short>^ collisionFilterMasks)
+{
+	if (items == nullptr)
+		throw gcnew ArgumentNullException("items");
+	if ((collisionFilterGroups == nullptr) != (collisionFilterMasks == nullptr))
+		throw gcnew ArgumentException("Either both or none of the filter arrays must be given.", "collisionFilterMasks");
+
+	int count = items->Length;
+	if (collisionFilterGroups != nullptr)
+	{
+		CheckStateArrayLength(collisionFilterGroups, count, "collisionFilterGroups");
+		CheckStateArrayLength(collisionFilterMasks, count, "collisionFilterMasks");
+	}
+	for (int i = 0; i < count; i++)
+	{
+		if (items[i] == nullptr)
+			throw gcnew ArgumentNullException("items");
+	}
+
+	_version++;
+	if (!_collisionWorld)
+	{
+		Native->reserve(Native->size() + count);
+		for (int i = 0; i < count; i++)
+		{
+			Native->push_back(items[i]->_native);
+		}
+		return;
+	}
+
+	// Rigid bodies without a shape are skipped like in Add
+	btCollisionObject** objects = new btCollisionObject*[count];
+	short* groups = collisionFilterGroups ? new short[count] : 0;
+	short* masks = collisionFilterMasks ? new short[count] : 0;
+	List<CollisionObject^>^ added = gcnew List<CollisionObject^>(count);
+	for (int i = 0; i < count; i++)
+	{
+		CollisionObject^ item = items[i];
+		if (item->_native->getInternalType() == btCollisionObject::CO_RIGID_BODY && item->CollisionShape == nullptr)
+			continue;
+
+		int n = added->Count;
+		objects[n] = item->_native;
+		if (groups)
+		{
+			groups[n] = collisionFilterGroups[i];
+			masks[n] = collisionFilterMasks[i];
+		}
+		added->Add(item);
+	}
+
+	AlignedCollisionObjectArray_AddRange(_collisionWorld, objects, groups, masks, added->Count);
+
+	delete[] objects;
+	delete[] groups;
+	delete[] masks;
+
+	btBroadphaseInterface* broadphase = _collisionWorld->getBroadphase();
+	_backingList->Capacity = btMax(_backingList->Capacity, _backingList->Count + added->Count);
+	for each (CollisionObject^ item in added)
+	{
+		item->_broadphase = broadphase;
+		_backingList->Add(item);
+		AddHandle(item);
+	}
+}
+
+void AlignedCollisionObjectArray::AddRange(array<CollisionObject^>^ items)
+{
+	AddRange(items, nullptr, nullptr);
+}
+
+void AlignedCollisionObjectArray::AddHandle(CollisionObject^ item)
+{
+	int slot;
+	if (_freeHandles->Count != 0)
+	{
+		slot = _freeHandles->Dequeue();
+		_handleObjects[slot] = item;
+	}
+	else
+	{
+		slot = _handleObjects->Count;
+		if (slot > HandleSlotMask)
+			throw gcnew InvalidOperationException("Too many collision objects.");
+		_handleObjects->Add(item);
+		_handleGenerations->Add(0);
+	}
+	int handle = (_handleGenerations[slot] << HandleSlotBits) | slot;
+	item->_worldHandle = handle;
+	_worldIndexHandles->Add(handle);
 }
 
 void AlignedCollisionObjectArray::Clear()
 {
 	Native->resizeNoInitialize(0);
+	_version++;
 	if (_backingList)
     {
+        for each (CollisionObject^ item in _backingList)
+        {
+            item->_worldHandle = 0;
+        }
         _backingList->Clear();
+        // Keep the generations so that handles from before the Clear stay invalid
+        for (int i = 1; i < _handleObjects->Count; i++)
+        {
+            if (_handleObjects[i] != nullptr)
+            {
+                _handleObjects[i] = nullptr;
+                _handleGenerations[i] = (_handleGenerations[i] + 1) & HandleGenerationMask;
+                _freeHandles->Enqueue(i);
+            }
+        }
+        _worldIndexHandles->Clear();
     }
 }
 
 bool AlignedCollisionObjectArray::Contains(CollisionObject^ item)
 {
-	return Native->findLinearSearch(item->UnmanagedPointer) != Native->size();
+	return IndexOf(item) != -1;
 }
 
 void AlignedCollisionObjectArray::CopyTo(array<CollisionObject^>^ array, int arrayIndex)
@@ -555,7 +723,43 @@ void AlignedCollisionObjectArray::CopyTo(array<CollisionObject^>^ array, int arr
 	}
 }
 
-System::Collections::IEnumerator^ AlignedCollisionObjectArray::GetEnumerator()
+AlignedCollisionObjectArray::Enumerator::Enumerator(AlignedCollisionObjectArray^ array)
+{
+	_array = array;
+	_index = -1;
+	_count = array->Count;
+	_version = array->_version;
+}
+
+CollisionObject^ AlignedCollisionObjectArray::Enumerator::Current::get()
+{
+	if (_array->_backingList)
+	{
+		return _array->_backingList[_index];
+	}
+	return CollisionObject::GetManaged(static_cast<btCollisionObjectArray*>(_array->_native)->at(_index));
+}
+
+// The native size also catches objects added or removed by Bullet itself
+bool AlignedCollisionObjectArray::Enumerator::MoveNext()
+{
+	if (_version != _array->_version || _count != static_cast<btCollisionObjectArray*>(_array->_native)->size())
+		throw gcnew InvalidOperationException("Collection was modified; enumeration operation may not execute.");
+	_index++;
+	return (_index < _count);
+}
+
+void AlignedCollisionObjectArray::Enumerator::Reset()
+{
+	_index = -1;
+}
+
+AlignedCollisionObjectArray::Enumerator AlignedCollisionObjectArray::GetEnumerator()
+{
+	return Enumerator(this);
+}
+
+System::Collections::IEnumerator^ AlignedCollisionObjectArray::GetObjectEnumerator()
 {
 	if (_backingList)
 	{
@@ -567,6 +771,41 @@ System::Collections::IEnumerator^ AlignedCollisionObjectArray::GetEnumerator()
 	}
 }
 
+CollisionObject^ AlignedCollisionObjectArray::GetByHandle(int handle)
+{
+	if (_handleObjects == nullptr)
+		throw gcnew InvalidOperationException("Only the collision object array of a world has handles.");
+
+	CollisionObject^ item = GetByHandleInternal(handle);
+	if (item == nullptr)
+		throw gcnew ArgumentOutOfRangeException("handle");
+	return item;
+}
+
+CollisionObject^ AlignedCollisionObjectArray::GetByHandleInternal(int handle)
+{
+	int slot = handle & HandleSlotMask;
+	if (handle <= 0 || slot >= _handleObjects->Count)
+		return nullptr;
+	if (_handleGenerations[slot] != (handle >> HandleSlotBits))
+		return nullptr;
+	return _handleObjects[slot];
+}
+
+// Returns 0 for objects that were not added through this collection
+int AlignedCollisionObjectArray::GetHandle(btCollisionObject* collisionObject)
+{
+	if (_backingList == nullptr)
+		return 0;
+
+	int worldIndex = collisionObject->getWorldArrayIndex();
+	if ((unsigned int)worldIndex >= (unsigned int)_backingList->Count)
+		return 0;
+	if (_backingList[worldIndex]->_native != collisionObject)
+		return 0;
+	return _worldIndexHandles[worldIndex];
+}
+
 IEnumerator<CollisionObject^>^ AlignedCollisionObjectArray::GetSpecializedEnumerator()
 {
 	if (_backingList)
@@ -581,13 +820,35 @@ IEnumerator<CollisionObject^>^ AlignedCollisionObjectArray::GetSpecializedEnumer
 
 int AlignedCollisionObjectArray::IndexOf(CollisionObject^ item)
 {
-	int i = Native->findLinearSearch(item->UnmanagedPointer);
+	btCollisionObject* itemPtr = item->_native;
+
+	// Objects in a world know their index in the world array
+	int i = itemPtr->getWorldArrayIndex();
+	if ((unsigned int)i < (unsigned int)Native->size() && (*Native)[i] == itemPtr)
+	{
+		return i;
+	}
+	if (_backingList)
+	{
+		return -1;
+	}
+
+	i = Native->findLinearSearch(itemPtr);
 	return i != Native->size() ? i : -1;
 }
 
 void AlignedCollisionObjectArray::PopBack()
 {
+	if (_backingList)
+	{
+		// Remove the object from the world too
+		int count = _backingList->Count;
+		if (count != 0)
+			Remove(_backingList[count - 1]);
+		return;
+	}
 	Native->pop_back();
+	_version++;
 }
 
 bool AlignedCollisionObjectArray::Remove(CollisionObject^ item)
@@ -598,44 +859,210 @@ bool AlignedCollisionObjectArray::Remove(CollisionObject^ item)
     {
         int sizeBefore = Native->size();
 		Native->remove(itemPtr);
-		return sizeBefore != Native->size();
+		if (sizeBefore == Native->size())
+			return false;
+		_version++;
+		return true;
     }
 
+    // The world array index of the object is also its index in _backingList
+    int i = itemPtr->getWorldArrayIndex();
     int count = _backingList->Count;
-    for (int i = 0; i < count; i++)
+    if ((unsigned int)i >= (unsigned int)count || _backingList[i]->_native != itemPtr)
     {
-        if (_backingList[i]->_native == itemPtr)
-        {
-            if (dynamic_cast<RigidBody^>(item) != nullptr)
-            {
-                static_cast<btDynamicsWorld*>(_collisionWorld)->removeRigidBody((btRigidBody*)itemPtr);
-            }
-            else if (dynamic_cast<SoftBody::SoftBody^>(item) != nullptr)
-            {
-                static_cast<btSoftRigidDynamicsWorld*>(_collisionWorld)->removeSoftBody((btSoftBody*)itemPtr);
-            }
-            else
-            {
-                _collisionWorld->removeCollisionObject(itemPtr);
-            }
-			_backingList[i]->BroadphaseHandle = nullptr;
-            count--;
+        return false;
+    }
 
-            // Swap the removed item with the last item like Bullet does.
-            if (i != count)
-            {
-                _backingList[i] = _backingList[count];
-            }
-            _backingList->RemoveAt(count);
-            return true;
+    if (dynamic_cast<RigidBody^>(item) != nullptr)
+    {
+        static_cast<btDynamicsWorld*>(_collisionWorld)->removeRigidBody((btRigidBody*)itemPtr);
+    }
+    else if (dynamic_cast<SoftBody::SoftBody^>(item) != nullptr)
+    {
+        static_cast<btSoftRigidDynamicsWorld*>(_collisionWorld)->removeSoftBody((btSoftBody*)itemPtr);
+        DefaultSoftBodySolver^ solver = dynamic_cast<DefaultSoftBodySolver^>(static_cast<SoftBody::SoftBody^>(item)->SoftBodySolver);
+        if (solver != nullptr)
+        {
+            solver->OnSoftBodyRemoved(static_cast<SoftBody::SoftBody^>(item));
         }
     }
-    return false;
+    else
+    {
+        _collisionWorld->removeCollisionObject(itemPtr);
+    }
+    _backingList[i]->BroadphaseHandle = nullptr;
+    _backingList[i]->_broadphase = 0;
+    count--;
+
+    int slot = _worldIndexHandles[i] & HandleSlotMask;
+    _handleObjects[slot] = nullptr;
+    _handleGenerations[slot] = (_handleGenerations[slot] + 1) & HandleGenerationMask;
+    _freeHandles->Enqueue(slot);
+    _backingList[i]->_worldHandle = 0;
+
+    // Swap the removed item with the last item like Bullet does.
+    if (i != count)
+    {
+        _backingList[i] = _backingList[count];
+        _worldIndexHandles[i] = _worldIndexHandles[count];
+    }
+    _backingList->RemoveAt(count);
+    _worldIndexHandles->RemoveAt(count);
+    _version++;
+    return true;
+}
+
+int AlignedCollisionObjectArray::RemoveRange(array<CollisionObject^>^ items)
+{
+	if (items == nullptr)
+		throw gcnew ArgumentNullException("items");
+
+	// Each removal is O(1), see Remove
+	int removed = 0;
+	for each (CollisionObject^ item in items)
+	{
+		if (item != nullptr && Remove(item))
+			removed++;
+	}
+	return removed;
+}
+
+void AlignedCollisionObjectArray::CheckStateArrayLength(System::Array^ array, int length, String^ paramName)
+{
+	if (array != nullptr && array->Length < length)
+		throw gcnew ArgumentException("Array too small.", paramName);
+}
+
+void AlignedCollisionObjectArray_GetState(const btCollisionObject* object, int i, array<Matrix>^ worldTransforms,
+	array<Vector3>^ linearVelocities, array<Vector3>^ angularVelocities)
+{
+	if (worldTransforms != nullptr)
+	{
+		Math::BtTransformToMatrix(&object->getWorldTransform(), worldTransforms[i]);
+	}
+
+	const btRigidBody* body = btRigidBody::upcast(object);
+	if (linearVelocities != nullptr)
+	{
+		if (body)
+			Math::BtVector3ToVector3(&body->getLinearVelocity(), linearVelocities[i]);
+		else
+			linearVelocities[i] = Vector3_Zero;
+	}
+	if (angularVelocities != nullptr)
+	{
+		if (body)
+			Math::BtVector3ToVector3(&body->getAngularVelocity(), angularVelocities[i]);
+		else
+			angularVelocities[i] = Vector3_Zero;
+	}
+}
+
+void AlignedCollisionObjectArray::GetStates(array<Matrix>^ worldTransforms, array<Vector3>^ linearVelocities,
+	array<Vector3>^ angularVelocities, array<BulletSharp::ActivationState>^ activationStates)
+{
+	int size = Native->size();
+	CheckStateArrayLength(worldTransforms, size, "worldTransforms");
+	CheckStateArrayLength(linearVelocities, size, "linearVelocities");
+	CheckStateArrayLength(angularVelocities, size, "angularVelocities");
+	CheckStateArrayLength(activationStates, size, "activationStates");
+	if (size == 0)
+		return;
+
+	btCollisionObject** objects = &(*Native)[0];
+	for (int i = 0; i < size; i++)
+	{
+		const btCollisionObject* object = objects[i];
+		AlignedCollisionObjectArray_GetState(object, i, worldTransforms, linearVelocities, angularVelocities);
+		if (activationStates != nullptr)
+			activationStates[i] = (BulletSharp::ActivationState)object->getActivationState();
+	}
+}
+
+void AlignedCollisionObjectArray::GetStates(array<int>^ indices, array<Matrix>^ worldTransforms,
+	array<Vector3>^ linearVelocities, array<Vector3>^ angularVelocities,
+	array<BulletSharp::ActivationState>^ activationStates)
+{
+	if (indices == nullptr)
+		throw gcnew ArgumentNullException("indices");
+
+	int count = indices->Length;
+	CheckStateArrayLength(worldTransforms, count, "worldTransforms");
+	CheckStateArrayLength(linearVelocities, count, "linearVelocities");
+	CheckStateArrayLength(angularVelocities, count, "angularVelocities");
+	CheckStateArrayLength(activationStates, count, "activationStates");
+
+	// Validate all indices before writing so that the outputs are untouched on failure
+	unsigned int size = (unsigned int)Native->size();
+	for (int i = 0; i < count; i++)
+	{
+		if ((unsigned int)indices[i] >= size)
+			throw gcnew ArgumentOutOfRangeException("indices");
+	}
+
+	btCollisionObject** objects = size ? &(*Native)[0] : 0;
+	for (int i = 0; i < count; i++)
+	{
+		const btCollisionObject* object = objects[indices[i]];
+		AlignedCollisionObjectArray_GetState(object, i, worldTransforms, linearVelocities, angularVelocities);
+		if (activationStates != nullptr)
+			activationStates[i] = (BulletSharp::ActivationState)object->getActivationState();
+	}
+}
+
+int AlignedCollisionObjectArray::GetActiveStates(array<int>^ activeIndices, array<Matrix>^ worldTransforms,
+	array<Vector3>^ linearVelocities, array<Vector3>^ angularVelocities)
+{
+	if (activeIndices == nullptr)
+		throw gcnew ArgumentNullException("activeIndices");
+
+	int size = Native->size();
+	CheckStateArrayLength(activeIndices, size, "activeIndices");
+	CheckStateArrayLength(worldTransforms, size, "worldTransforms");
+	CheckStateArrayLength(linearVelocities, size, "linearVelocities");
+	CheckStateArrayLength(angularVelocities, size, "angularVelocities");
+	if (size == 0)
+		return 0;
+
+	int count = 0;
+	btCollisionObject** objects = &(*Native)[0];
+	for (int i = 0; i < size; i++)
+	{
+		const btCollisionObject* object = objects[i];
+		if (!object->isActive() || object->isStaticObject())
+			continue;
+
+		AlignedCollisionObjectArray_GetState(object, i, worldTransforms, linearVelocities, angularVelocities);
+		activeIndices[count++] = i;
+	}
+	return count;
 }
 
 void AlignedCollisionObjectArray::Swap(int index0, int index1)
 {
+	unsigned int size = (unsigned int)Native->size();
+	if ((unsigned int)index0 >= size)
+		throw gcnew ArgumentOutOfRangeException("index0");
+	if ((unsigned int)index1 >= size)
+		throw gcnew ArgumentOutOfRangeException("index1");
+
 	Native->swap(index0, index1);
+	_version++;
+
+	if (_backingList)
+	{
+		// Keep the world array indices that Remove, IndexOf and GetHandle rely on
+		(*Native)[index0]->setWorldArrayIndex(index0);
+		(*Native)[index1]->setWorldArrayIndex(index1);
+
+		CollisionObject^ item = _backingList[index0];
+		_backingList[index0] = _backingList[index1];
+		_backingList[index1] = item;
+
+		int handle = _worldIndexHandles[index0];
+		_worldIndexHandles[index0] = _worldIndexHandles[index1];
+		_worldIndexHandles[index1] = handle;
+	}
 }
 
 int AlignedCollisionObjectArray::Capacity::get()
@@ -662,9 +1089,12 @@ CollisionObject^ AlignedCollisionObjectArray::default::get(int index)
 }
 void AlignedCollisionObjectArray::default::set(int index, CollisionObject^ value)
 {
+	if (_backingList)
+		throw gcnew InvalidOperationException("Objects of a world can't be replaced, use Remove and Add instead.");
 	if ((unsigned int)index >= (unsigned int)Native->size())
 		throw gcnew ArgumentOutOfRangeException("index");
 	(*Native)[index] = GetUnmanagedNullable(value);
+	_version++;
 }
 
 
@@ -1052,6 +1482,25 @@ bool AlignedIntArray::Contains(int integer)
 		!= Native->size();
 }
 
+void AlignedIntArray::CopyFrom(array<int>^ array)
+{
+	if (array == nullptr)
+		throw gcnew ArgumentNullException("array");
+
+	Native->resize(array->Length);
+	CopyFrom(0, array, 0, array->Length);
+}
+
+void AlignedIntArray::CopyFrom(int index, array<int>^ array, int arrayIndex, int count)
+{
+	CheckCopyRange(index, array, arrayIndex, count, Native->size());
+	if (count == 0)
+		return;
+
+	pin_ptr<int> arrayPtr = &array[arrayIndex];
+	memcpy(&(*Native)[index], arrayPtr, count * sizeof(int));
+}
+
 void AlignedIntArray::CopyTo(array<int>^ array, int arrayIndex)
 {
 	if (array == nullptr)
@@ -1064,11 +1513,47 @@ void AlignedIntArray::CopyTo(array<int>^ array, int arrayIndex)
 	if (arrayIndex + size > array->Length)
 		throw gcnew ArgumentException("Array too small.", "array");
 
-	int i;
-	for (i=0; i<size; i++)
-	{
-		array[arrayIndex+i] = (*Native)[i];
-	}
+	CopyTo(0, array, arrayIndex, size);
+}
+
+void AlignedIntArray::CopyTo(int index, array<int>^ array, int arrayIndex, int count)
+{
+	CheckCopyRange(index, array, arrayIndex, count, Native->size());
+	if (count == 0)
+		return;
+
+	pin_ptr<int> arrayPtr = &array[arrayIndex];
+	memcpy(arrayPtr, &(*Native)[index], count * sizeof(int));
+}
+
+AlignedIntArray::Enumerator::Enumerator(AlignedIntArray^ array)
+{
+	_array = array;
+	_index = -1;
+	_count = array->Count;
+}
+
+int AlignedIntArray::Enumerator::Current::get()
+{
+	return (*static_cast<btAlignedObjectArray<int>*>(_array->_native))[_index];
+}
+
+bool AlignedIntArray::Enumerator::MoveNext()
+{
+	if (_count != static_cast<btAlignedObjectArray<int>*>(_array->_native)->size())
+		throw gcnew InvalidOperationException("Collection was modified; enumeration operation may not execute.");
+	_index++;
+	return (_index < _count);
+}
+
+void AlignedIntArray::Enumerator::Reset()
+{
+	_index = -1;
+}
+
+AlignedIntArray::Enumerator AlignedIntArray::GetEnumerator()
+{
+	return Enumerator(this);
 }
 
 int AlignedIntArray::IndexOf(int integer)
@@ -1114,6 +1599,11 @@ int AlignedIntArray::Count::get()
 	return Native->size();
 }
 
+IntPtr AlignedIntArray::DataPointer::get()
+{
+	return Native->size() ? IntPtr(&(*Native)[0]) : IntPtr::Zero;
+}
+
 int AlignedIntArray::default::get(int index)
 {
 	if ((unsigned int)index >= (unsigned int)Native->size())
@@ -2083,6 +2573,25 @@ bool AlignedScalarArray::Contains(btScalar scalar)
 		!= Native->size();
 }
 
+void AlignedScalarArray::CopyFrom(array<btScalar>^ array)
+{
+	if (array == nullptr)
+		throw gcnew ArgumentNullException("array");
+
+	Native->resize(array->Length);
+	CopyFrom(0, array, 0, array->Length);
+}
+
+void AlignedScalarArray::CopyFrom(int index, array<btScalar>^ array, int arrayIndex, int count)
+{
+	CheckCopyRange(index, array, arrayIndex, count, Native->size());
+	if (count == 0)
+		return;
+
+	pin_ptr<btScalar> arrayPtr = &array[arrayIndex];
+	memcpy(&(*Native)[index], arrayPtr, count * sizeof(btScalar));
+}
+
 void AlignedScalarArray::CopyTo(array<btScalar>^ array, int arrayIndex)
 {
 	if (array == nullptr)
@@ -2095,11 +2604,47 @@ void AlignedScalarArray::CopyTo(array<btScalar>^ array, int arrayIndex)
 	if (arrayIndex + size > array->Length)
 		throw gcnew ArgumentException("Array too small.", "array");
 
-	int i;
-	for (i=0; i<size; i++)
-	{
-		array[arrayIndex+i] = (*Native)[i];
-	}
+	CopyTo(0, array, arrayIndex, size);
+}
+
+void AlignedScalarArray::CopyTo(int index, array<btScalar>^ array, int arrayIndex, int count)
+{
+	CheckCopyRange(index, array, arrayIndex, count, Native->size());
+	if (count == 0)
+		return;
+
+	pin_ptr<btScalar> arrayPtr = &array[arrayIndex];
+	memcpy(arrayPtr, &(*Native)[index], count * sizeof(btScalar));
+}
+
+AlignedScalarArray::Enumerator::Enumerator(AlignedScalarArray^ array)
+{
+	_array = array;
+	_index = -1;
+	_count = array->Count;
+}
+
+btScalar AlignedScalarArray::Enumerator::Current::get()
+{
+	return (*static_cast<btAlignedObjectArray<btScalar>*>(_array->_native))[_index];
+}
+
+bool AlignedScalarArray::Enumerator::MoveNext()
+{
+	if (_count != static_cast<btAlignedObjectArray<btScalar>*>(_array->_native)->size())
+		throw gcnew InvalidOperationException("Collection was modified; enumeration operation may not execute.");
+	_index++;
+	return (_index < _count);
+}
+
+void AlignedScalarArray::Enumerator::Reset()
+{
+	_index = -1;
+}
+
+AlignedScalarArray::Enumerator AlignedScalarArray::GetEnumerator()
+{
+	return Enumerator(this);
 }
 
 int AlignedScalarArray::IndexOf(btScalar scalar)
@@ -2130,6 +2675,11 @@ int AlignedScalarArray::Count::get()
 	return Native->size();
 }
 
+IntPtr AlignedScalarArray::DataPointer::get()
+{
+	return Native->size() ? IntPtr(&(*Native)[0]) : IntPtr::Zero;
+}
+
 void AlignedScalarArray::Swap(int index0, int index1)
 {
 	Native->swap(index0, index1);
@@ -2513,9 +3063,9 @@ void AlignedVector3Array::Add(Vector3 vector3Value)
 
 void AlignedVector3Array::Add(Vector4 vector4Value)
 {
-	btVector4* tempVector4Value = Math::Vector4ToBtVector4(vector4Value);
-	Native->push_back(*tempVector4Value);
-	delete tempVector4Value;
+	VECTOR4_CONV(vector4Value);
+	Native->push_back(VECTOR4_USE(vector4Value));
+	VECTOR4_DEL(vector4Value);
 }
 
 void AlignedVector3Array::Clear()
@@ -2531,6 +3081,25 @@ bool AlignedVector3Array::Contains(Vector3 vector)
 	return i != Native->size();
 }
 
+void AlignedVector3Array::CopyFrom(array<Vector3>^ array)
+{
+	if (array == nullptr)
+		throw gcnew ArgumentNullException("array");
+
+	Native->resize(array->Length);
+	CopyFrom(0, array, 0, array->Length);
+}
+
+void AlignedVector3Array::CopyFrom(int index, array<Vector3>^ array, int arrayIndex, int count)
+{
+	CheckCopyRange(index, array, arrayIndex, count, Native->size());
+	if (count == 0)
+		return;
+
+	pin_ptr<Vector3> arrayPtr = &array[arrayIndex];
+	Math::Vector3ArrayToBtVector3Array(arrayPtr, &(*Native)[index], sizeof(btVector3), count);
+}
+
 void AlignedVector3Array::CopyTo(array<Vector3>^ array, int arrayIndex)
 {
 	if (array == nullptr)
@@ -2543,11 +3112,47 @@ void AlignedVector3Array::CopyTo(array<Vector3>^ array, int arrayIndex)
 	if (arrayIndex + size > array->Length)
 		throw gcnew ArgumentException("Array too small.", "array");
 
-	int i;
-	for (i=0; i<size; i++)
-	{
-		Math::BtVector3ToVector3(&(*Native)[i], array[arrayIndex+i]);
-	}
+	CopyTo(0, array, arrayIndex, size);
+}
+
+void AlignedVector3Array::CopyTo(int index, array<Vector3>^ array, int arrayIndex, int count)
+{
+	CheckCopyRange(index, array, arrayIndex, count, Native->size());
+	if (count == 0)
+		return;
+
+	pin_ptr<Vector3> arrayPtr = &array[arrayIndex];
+	Math::BtVector3ArrayToVector3Array(&(*Native)[index], sizeof(btVector3), arrayPtr, count);
+}
+
+AlignedVector3Array::Enumerator::Enumerator(AlignedVector3Array^ array)
+{
+	_array = array;
+	_index = -1;
+	_count = array->Count;
+}
+
+Vector3 AlignedVector3Array::Enumerator::Current::get()
+{
+	return Math::BtVector3ToVector3(&(*static_cast<btAlignedObjectArray<btVector3>*>(_array->_native))[_index]);
+}
+
+bool AlignedVector3Array::Enumerator::MoveNext()
+{
+	if (_count != static_cast<btAlignedObjectArray<btVector3>*>(_array->_native)->size())
+		throw gcnew InvalidOperationException("Collection was modified; enumeration operation may not execute.");
+	_index++;
+	return (_index < _count);
+}
+
+void AlignedVector3Array::Enumerator::Reset()
+{
+	_index = -1;
+}
+
+AlignedVector3Array::Enumerator AlignedVector3Array::GetEnumerator()
+{
+	return Enumerator(this);
 }
 
 int AlignedVector3Array::IndexOf(Vector3 vector)
@@ -2582,6 +3187,11 @@ int AlignedVector3Array::Count::get()
 	return Native->size();
 }
 
+IntPtr AlignedVector3Array::DataPointer::get()
+{
+	return Native->size() ? IntPtr(&(*Native)[0]) : IntPtr::Zero;
+}
+
 void AlignedVector3Array::Swap(int index0, int index1)
 {
 	Native->swap(index0, index1);
@@ -2600,6 +3210,11 @@ void AlignedVector3Array::default::set(int index, Vector3 value)
 	Math::Vector3ToBtVector3(value, &(*Native)[index]);
 }
 
+int AlignedVector3Array::Stride::get()
+{
+	return sizeof(btVector3);
+}
+
 
 #ifndef DISABLE_SOFTBODY
 
@@ -58,7 +58,8 @@ namespace BulletSharp
 		virtual void Clear() = 0;
 		virtual bool Contains(T item);
 		virtual void CopyTo(array<T>^ array, int arrayIndex) = 0;
-		virtual System::Collections::IEnumerator^ GetEnumerator() = System::Collections::IEnumerable::GetEnumerator;
+		ListValueEnumerator<T> GetEnumerator();
+		virtual System::Collections::IEnumerator^ GetObjectEnumerator() = System::Collections::IEnumerable::GetEnumerator;
 		virtual IEnumerator<T>^ GetSpecializedEnumerator() = IEnumerable<T>::GetEnumerator;
 		virtual int IndexOf(T item);
 		virtual void Insert(int index, T item);
@@ -216,17 +217,89 @@ namespace BulletSharp
 		btCollisionWorld* _collisionWorld;
 		List<CollisionObject^>^ _backingList;
 
+		// Handle table of world collections. The low HandleSlotBits of a handle index _handleObjects,
+		// the bits above hold the generation of the slot, which changes every time the slot is freed
+		// so that stale handles don't find the next object in the slot.
+		// Freed slots are reused oldest first, so a stale handle can only match again after
+		// its slot has been freed HandleGenerationMask + 1 times, which takes at least that many
+		// removals times the number of free slots.
+		// Slot 0 is never assigned, handle 0 means "no handle".
+		literal int HandleSlotBits = 20;
+		literal int HandleSlotMask = (1 << HandleSlotBits) - 1;
+		literal int HandleGenerationMask = 0x7FF;
+		List<CollisionObject^>^ _handleObjects;
+		List<int>^ _handleGenerations;
+		Queue<int>^ _freeHandles;
+		List<int>^ _worldIndexHandles;
+		// Changed by every modification through this collection
+		int _version;
+
+		void AddHandle(CollisionObject^ item);
+		static void CheckStateArrayLength(System::Array^ array, int length, String^ paramName);
+
+	internal:
+		int GetHandle(btCollisionObject* collisionObject);
+		CollisionObject^ GetByHandleInternal(int handle);
+
 	public:
+		// Reads the world's backing list or the native array without going through IList.
+		// Throws InvalidOperationException if the collection is modified during enumeration.
+		value struct Enumerator
+		{
+		private:
+			AlignedCollisionObjectArray^ _array;
+			int _index;
+			int _count;
+			int _version;
+
+		internal:
+			Enumerator(AlignedCollisionObjectArray^ array);
+
+		public:
+			property CollisionObject^ Current
+			{
+				CollisionObject^ get();
+			}
+
+			bool MoveNext();
+			void Reset();
+		};
+
 		virtual void Add(CollisionObject^ item) override;
 		void Add(CollisionObject^ item, short collisionFilterGroup, short collisionFilterMask);
+		// Adds the objects in one native pass. A dbvt broadphase is rebuilt once afterwards
+		// if the batch at least doubled its number of proxies, small batches are inserted incrementally.
+		// The filter arrays can both be null to use the default groups and masks.
+		void AddRange(array<CollisionObject^>^ items, array<short>^ collisionFilterGroups,
+			array<short>^ collisionFilterMasks);
+		void AddRange(array<CollisionObject^>^ items);
 		virtual void Clear() override;
 		virtual bool Contains(CollisionObject^ item) override;
 		virtual void CopyTo(array<CollisionObject^>^ array, int arrayIndex) override;
-		virtual System::Collections::IEnumerator^ GetEnumerator() override;
+		// Returns the object with the given CollisionObject.WorldHandle
+		CollisionObject^ GetByHandle(int handle);
+		Enumerator GetEnumerator();
+		virtual System::Collections::IEnumerator^ GetObjectEnumerator() override;
 		virtual IEnumerator<CollisionObject^>^ GetSpecializedEnumerator() override;
+
+		// Copies the state of all objects into arrays indexed like this collection.
+		// Any of the arrays can be null to skip that part of the state.
+		// Objects that are not rigid bodies get zero velocities.
+		void GetStates(array<Matrix>^ worldTransforms, array<Vector3>^ linearVelocities,
+			array<Vector3>^ angularVelocities, array<BulletSharp::ActivationState>^ activationStates);
+		// Copies the state of the objects at the given indices.
+		// Element i of the output arrays receives the state of object indices[i].
+		void GetStates(array<int>^ indices, array<Matrix>^ worldTransforms, array<Vector3>^ linearVelocities,
+			array<Vector3>^ angularVelocities, array<BulletSharp::ActivationState>^ activationStates);
+		// Copies the state of active non-static objects only, leaving the entries of sleeping objects untouched.
+		// The indices of the updated objects are written to activeIndices, the return value is their count.
+		int GetActiveStates(array<int>^ activeIndices, array<Matrix>^ worldTransforms,
+			array<Vector3>^ linearVelocities, array<Vector3>^ angularVelocities);
 		virtual int IndexOf(CollisionObject^ item) override;
 		virtual void PopBack() override;
 		virtual bool Remove(CollisionObject^ item) override;
+		// Returns the number of objects that were removed
+		int RemoveRange(array<CollisionObject^>^ items);
 		virtual void Swap(int index0, int index1) override;
 
 		property int Capacity
@@ -431,10 +504,36 @@ namespace BulletSharp
 	public:
 		AlignedIntArray();
 
+		// Reads the native array without going through IList.
+		// Throws InvalidOperationException if the array is resized during enumeration.
+		value struct Enumerator
+		{
+		private:
+			AlignedIntArray^ _array;
+			int _index;
+			int _count;
+
+		internal:
+			Enumerator(AlignedIntArray^ array);
+
+		public:
+			property int Current
+			{
+				int get();
+			}
+
+			bool MoveNext();
+			void Reset();
+		};
+
 		virtual void Add(int integer) override;
 		virtual void Clear() override;
 		virtual bool Contains(int integer) override;
+		void CopyFrom(array<int>^ array);
+		void CopyFrom(int index, array<int>^ array, int arrayIndex, int count);
 		virtual void CopyTo(array<int>^ array, int arrayIndex) override;
+		void CopyTo(int index, array<int>^ array, int arrayIndex, int count);
+		Enumerator GetEnumerator();
 		virtual int IndexOf(int integer) override;
 		virtual void PopBack() override;
 		virtual bool Remove(int integer) override;
@@ -452,6 +551,12 @@ namespace BulletSharp
 			virtual int get() override;
 		}
 
+		// Address of the first element, valid until the array is resized.
+		property IntPtr DataPointer
+		{
+			IntPtr get();
+		}
+
 		property int default [int]
 		{
 			virtual int get (int index) override;
@@ -796,10 +901,35 @@ namespace BulletSharp
 	public:
 		AlignedScalarArray();
 
+		// Reads the native array directly, see AlignedIntArray::Enumerator
+		value struct Enumerator
+		{
+		private:
+			AlignedScalarArray^ _array;
+			int _index;
+			int _count;
+
+		internal:
+			Enumerator(AlignedScalarArray^ array);
+
+		public:
+			property btScalar Current
+			{
+				btScalar get();
+			}
+
+			bool MoveNext();
+			void Reset();
+		};
+
 		virtual void Add(btScalar scalar) override;
 		virtual void Clear() override;
 		virtual bool Contains(btScalar scalar) override;
+		void CopyFrom(array<btScalar>^ array);
+		void CopyFrom(int index, array<btScalar>^ array, int arrayIndex, int count);
 		virtual void CopyTo(array<btScalar>^ array, int arrayIndex) override;
+		void CopyTo(int index, array<btScalar>^ array, int arrayIndex, int count);
+		Enumerator GetEnumerator();
 		virtual int IndexOf(btScalar scalar) override;
 		virtual void PopBack() override;
 		virtual bool Remove(btScalar scalar) override;
@@ -815,6 +945,12 @@ namespace BulletSharp
 			virtual int get() override;
 		}
 
+		// Address of the first element, valid until the array is resized.
+		property IntPtr DataPointer
+		{
+			IntPtr get();
+		}
+
 		property btScalar default [int]
 		{
 			virtual btScalar get (int index) override;
@@ -972,11 +1108,36 @@ namespace BulletSharp
 	public:
 		AlignedVector3Array();
 
+		// Reads the native array directly, see AlignedIntArray::Enumerator
+		value struct Enumerator
+		{
+		private:
+			AlignedVector3Array^ _array;
+			int _index;
+			int _count;
+
+		internal:
+			Enumerator(AlignedVector3Array^ array);
+
+		public:
+			property Vector3 Current
+			{
+				Vector3 get();
+			}
+
+			bool MoveNext();
+			void Reset();
+		};
+
 		virtual void Add(Vector3 vector) override;
 		void Add(Vector4 vector);
 		virtual void Clear() override;
 		virtual bool Contains(Vector3 vector) override;
+		void CopyFrom(array<Vector3>^ array);
+		void CopyFrom(int index, array<Vector3>^ array, int arrayIndex, int count);
 		virtual void CopyTo(array<Vector3>^ array, int arrayIndex) override;
+		void CopyTo(int index, array<Vector3>^ array, int arrayIndex, int count);
+		Enumerator GetEnumerator();
 		virtual int IndexOf(Vector3 vector) override;
 		virtual void PopBack() override;
 		virtual bool Remove(Vector3 vector) override;
@@ -992,11 +1153,22 @@ namespace BulletSharp
 			virtual int get() override;
 		}
 
+		// Address of the first element, valid until the array is resized.
+		property IntPtr DataPointer
+		{
+			IntPtr get();
+		}
+
 		property Vector3 default [int]
 		{
 			virtual Vector3 get (int index) override;
 			virtual void set(int index, Vector3 value) override;
 		}
+
+		property int Stride
+		{
+			int get();
+		}
 	};
 
 #ifndef DISABLE_SOFTBODY
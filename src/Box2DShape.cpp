@@ -18,34 +18,30 @@ Box2DShape::Box2DShape(Vector3 boxHalfExtents)
 Box2DShape::Box2DShape(btScalar boxHalfExtentsX, btScalar boxHalfExtentsY, btScalar boxHalfExtentsZ)
 	: PolyhedralConvexShape(0)
 {
-	btVector3* boxHalfExtentsTemp = ALIGNED_NEW(btVector3) (boxHalfExtentsX, boxHalfExtentsY, boxHalfExtentsZ);
+	ALIGNED_STACK(btVector3, boxHalfExtentsTemp) (boxHalfExtentsX, boxHalfExtentsY, boxHalfExtentsZ);
 	UnmanagedPointer = new btBox2dShape(*boxHalfExtentsTemp);
-	ALIGNED_FREE(boxHalfExtentsTemp);
 }
 
 Box2DShape::Box2DShape(btScalar boxHalfExtents)
 	: PolyhedralConvexShape(0)
 {
-	btVector3* boxHalfExtentsTemp = ALIGNED_NEW(btVector3) (boxHalfExtents, boxHalfExtents, boxHalfExtents);
+	ALIGNED_STACK(btVector3, boxHalfExtentsTemp) (boxHalfExtents, boxHalfExtents, boxHalfExtents);
 	UnmanagedPointer = new btBox2dShape(*boxHalfExtentsTemp);
-	ALIGNED_FREE(boxHalfExtentsTemp);
 }
 
 Vector3 Box2DShape::GetVertex(int i)
 {
-	btVector3* vertexTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, vertexTemp);
 	Native->getVertex(i, *vertexTemp);
 	Vector3 vertex = Math::BtVector3ToVector3(vertexTemp);
-	ALIGNED_FREE(vertexTemp);
 	return vertex;
 }
 
 Vector4 Box2DShape::GetPlaneEquation(int i)
 {
-	btVector4* equationTemp = ALIGNED_NEW(btVector4);
+	ALIGNED_STACK(btVector4, equationTemp);
 	Native->getPlaneEquation(*equationTemp, i);
 	Vector4 equation = Math::BtVector4ToVector4(equationTemp);
-	ALIGNED_FREE(equationTemp);
 	return equation;
 }
 
@@ -56,9 +52,8 @@ Vector3 Box2DShape::Centroid::get()
 
 Vector3 Box2DShape::HalfExtentsWithMargin::get()
 {
-	btVector3* extentsTemp = ALIGNED_NEW(btVector3) (Native->getHalfExtentsWithMargin());
+	ALIGNED_STACK(btVector3, extentsTemp) (Native->getHalfExtentsWithMargin());
 	Vector3 extents = Math::BtVector3ToVector3(extentsTemp);
-	ALIGNED_FREE(extentsTemp);
 	return extents;
 }
 
@@ -118,13 +118,11 @@ void Aabb::FindIntersection(Aabb^ other, Aabb^ intersection)
 
 void Aabb::GetCenterExtend([Out] Vector3% center, [Out] Vector3% extend)
 {
-	btVector3* centerTemp = ALIGNED_NEW(btVector3);
-	btVector3* extendTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, centerTemp);
+	ALIGNED_STACK(btVector3, extendTemp);
 	_native->get_center_extend(*centerTemp, *extendTemp);
 	Math::BtVector3ToVector3(centerTemp, center);
 	Math::BtVector3ToVector3(extendTemp, extend);
-	ALIGNED_FREE(centerTemp);
-	ALIGNED_FREE(extendTemp);
 }
 
 bool Aabb::HasCollision(Aabb^ other)
@@ -15,17 +15,15 @@ BoxShape::BoxShape(Vector3 boxHalfExtents)
 BoxShape::BoxShape(btScalar boxHalfExtentsX, btScalar boxHalfExtentsY, btScalar boxHalfExtentsZ)
 	: PolyhedralConvexShape(0)
 {
-	btVector3* boxHalfExtentsTemp = ALIGNED_NEW(btVector3) (boxHalfExtentsX,boxHalfExtentsY,boxHalfExtentsZ);
+	ALIGNED_STACK(btVector3, boxHalfExtentsTemp) (boxHalfExtentsX,boxHalfExtentsY,boxHalfExtentsZ);
 	UnmanagedPointer = new btBoxShape(*boxHalfExtentsTemp);
-	ALIGNED_FREE(boxHalfExtentsTemp);
 }
 
 BoxShape::BoxShape(btScalar boxHalfExtents)
 	: PolyhedralConvexShape(0)
 {
-	btVector3* boxHalfExtentsTemp = ALIGNED_NEW(btVector3) (boxHalfExtents, boxHalfExtents, boxHalfExtents);
+	ALIGNED_STACK(btVector3, boxHalfExtentsTemp) (boxHalfExtents, boxHalfExtents, boxHalfExtents);
 	UnmanagedPointer = new btBoxShape(*boxHalfExtentsTemp);
-	ALIGNED_FREE(boxHalfExtentsTemp);
 }
 
 Vector4 BoxShape::GetPlaneEquation(int index)
@@ -39,9 +37,8 @@ Vector4 BoxShape::GetPlaneEquation(int index)
 
 Vector3 BoxShape::HalfExtentsWithMargin::get()
 {
-	btVector3* extentsTemp = ALIGNED_NEW(btVector3) (Native->getHalfExtentsWithMargin());
+	ALIGNED_STACK(btVector3, extentsTemp) (Native->getHalfExtentsWithMargin());
 	Vector3 extents = Math::BtVector3ToVector3(extentsTemp);
-	ALIGNED_FREE(extentsTemp);
 	return extents;
 }
 
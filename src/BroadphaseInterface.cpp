@@ -145,24 +145,20 @@ void BroadphaseInterface::DestroyProxy(BroadphaseProxy^ proxy, Dispatcher^ dispa
 
 void BroadphaseInterface::GetAabb(BroadphaseProxy^ proxy, Vector3% aabbMin, Vector3% aabbMax)
 {
-	btVector3* aabbMinTemp = ALIGNED_NEW(btVector3);
-	btVector3* aabbMaxTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, aabbMinTemp);
+	ALIGNED_STACK(btVector3, aabbMaxTemp);
 	_native->getAabb(proxy->_native, *aabbMinTemp, *aabbMaxTemp);
 	Math::BtVector3ToVector3(aabbMinTemp, aabbMin);
 	Math::BtVector3ToVector3(aabbMaxTemp, aabbMax);
-	ALIGNED_FREE(aabbMinTemp);
-	ALIGNED_FREE(aabbMaxTemp);
 }
 
 void BroadphaseInterface::GetBroadphaseAabb(Vector3% aabbMin, Vector3% aabbMax)
 {
-	btVector3* aabbMinTemp = ALIGNED_NEW(btVector3);
-	btVector3* aabbMaxTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, aabbMinTemp);
+	ALIGNED_STACK(btVector3, aabbMaxTemp);
 	_native->getBroadphaseAabb(*aabbMinTemp, *aabbMaxTemp);
 	Math::BtVector3ToVector3(aabbMinTemp, aabbMin);
 	Math::BtVector3ToVector3(aabbMaxTemp, aabbMax);
-	ALIGNED_FREE(aabbMinTemp);
-	ALIGNED_FREE(aabbMaxTemp);
 }
 
 void BroadphaseInterface::PrintStats()
@@ -0,0 +1,416 @@
+#include "StdAfx.h"
+
+#ifndef DISABLE_DEBUGDRAW
+
+#include "BufferedDebugDraw.h"
+
+// Same values as DebugDrawCategories
+#define CATEGORY_LINES 1
+#define CATEGORY_AABBS 2
+#define CATEGORY_CONTACT_POINTS 4
+#define CATEGORY_TRANSFORMS 8
+#define CATEGORY_TRIANGLES 16
+
+#define Native static_cast<BufferedDebugDrawWrapper*>(_native)
+
+BufferedDebugDraw::BufferedDebugDraw()
+	: DebugDraw((DebugDrawWrapper*)0)
+{
+	_native = new BufferedDebugDrawWrapper(this);
+}
+
+void BufferedDebugDraw::Clear()
+{
+	Native->m_lines.resize(0);
+	Native->m_triangles.resize(0);
+}
+
+int BufferedDebugDraw_CopyVertices(btAlignedObjectArray<BufferedDebugDrawVertex>* source, array<DebugDrawVertex>^% vertices)
+{
+	int count = source->size();
+	if (vertices == nullptr || vertices->Length < count) {
+		vertices = gcnew array<DebugDrawVertex>(count);
+	}
+
+	if (count != 0) {
+		pin_ptr<DebugDrawVertex> vPtr = &vertices[0];
+		memcpy(vPtr, &(*source)[0], count * sizeof(BufferedDebugDrawVertex));
+	}
+
+	return count;
+}
+
+int BufferedDebugDraw::CopyLineVertices(array<DebugDrawVertex>^% vertices)
+{
+	return BufferedDebugDraw_CopyVertices(&Native->m_lines, vertices);
+}
+
+int BufferedDebugDraw::CopyTriangleVertices(array<DebugDrawVertex>^% vertices)
+{
+	return BufferedDebugDraw_CopyVertices(&Native->m_triangles, vertices);
+}
+
+void BufferedDebugDraw::SetFrustum(array<Vector4>^ planes)
+{
+	if (planes == nullptr)
+	{
+		Native->m_numPlanes = 0;
+		return;
+	}
+
+	if (planes->Length > 6)
+		throw gcnew ArgumentException("At most 6 planes are supported.", "planes");
+
+	for (int i = 0; i < planes->Length; i++)
+	{
+		Native->m_planes[i].setValue(Vector_X(planes[i]), Vector_Y(planes[i]), Vector_Z(planes[i]), Vector_W(planes[i]));
+	}
+	Native->m_numPlanes = planes->Length;
+}
+
+void BufferedDebugDraw::Draw3dText(Vector3% location, String^ textString)
+{
+}
+
+void BufferedDebugDraw::DrawContactPoint(Vector3% pointOnB, Vector3% normalOnB, btScalar distance, int lifeTime, BtColor color)
+{
+	VECTOR3_CONV(pointOnB);
+	VECTOR3_CONV(normalOnB);
+	btVector3* colorTemp = BtColorToBtVector(color);
+
+	Native->drawContactPoint(VECTOR3_USE(pointOnB), VECTOR3_USE(normalOnB), distance, lifeTime, *colorTemp);
+
+	VECTOR3_DEL(pointOnB);
+	VECTOR3_DEL(normalOnB);
+	delete colorTemp;
+}
+
+void BufferedDebugDraw::DrawLine(Vector3% from, Vector3% to, BtColor color)
+{
+	VECTOR3_CONV(from);
+	VECTOR3_CONV(to);
+	btVector3* colorTemp = BtColorToBtVector(color);
+
+	Native->drawLine(VECTOR3_USE(from), VECTOR3_USE(to), *colorTemp);
+
+	VECTOR3_DEL(from);
+	VECTOR3_DEL(to);
+	delete colorTemp;
+}
+
+void BufferedDebugDraw::DrawTriangle(Vector3% v0, Vector3% v1, Vector3% v2, BtColor color, btScalar alpha)
+{
+	VECTOR3_CONV(v0);
+	VECTOR3_CONV(v1);
+	VECTOR3_CONV(v2);
+	btVector3* colorTemp = BtColorToBtVector(color);
+
+	Native->drawTriangle(VECTOR3_USE(v0), VECTOR3_USE(v1), VECTOR3_USE(v2), *colorTemp, alpha);
+
+	VECTOR3_DEL(v0);
+	VECTOR3_DEL(v1);
+	VECTOR3_DEL(v2);
+	delete colorTemp;
+}
+
+void BufferedDebugDraw::ReportErrorWarning(String^ warningString)
+{
+	System::Diagnostics::Debug::WriteLine(warningString);
+}
+
+DebugDrawCategories BufferedDebugDraw::Categories::get()
+{
+	return (DebugDrawCategories)Native->m_categories;
+}
+void BufferedDebugDraw::Categories::set(DebugDrawCategories value)
+{
+	Native->m_categories = (int)value;
+}
+
+DebugDrawModes BufferedDebugDraw::DebugMode::get()
+{
+	return (DebugDrawModes)Native->m_debugMode;
+}
+void BufferedDebugDraw::DebugMode::set(DebugDrawModes value)
+{
+	Native->m_debugMode = (int)value;
+}
+
+int BufferedDebugDraw::LineVertexCount::get()
+{
+	return Native->m_lines.size();
+}
+
+IntPtr BufferedDebugDraw::LineVertices::get()
+{
+	return Native->m_lines.size() ? IntPtr(&Native->m_lines[0]) : IntPtr::Zero;
+}
+
+int BufferedDebugDraw::TriangleVertexCount::get()
+{
+	return Native->m_triangles.size();
+}
+
+IntPtr BufferedDebugDraw::TriangleVertices::get()
+{
+	return Native->m_triangles.size() ? IntPtr(&Native->m_triangles[0]) : IntPtr::Zero;
+}
+
+
+BufferedDebugDrawWrapper::BufferedDebugDrawWrapper(IDebugDraw^ debugDraw)
+	: DebugDrawWrapper(debugDraw, true)
+{
+	m_numPlanes = 0;
+	m_categories = CATEGORY_LINES | CATEGORY_AABBS | CATEGORY_CONTACT_POINTS | CATEGORY_TRANSFORMS | CATEGORY_TRIANGLES;
+	m_currentCategory = CATEGORY_LINES;
+	m_debugMode = 0;
+}
+
+#pragma managed(push, off)
+int BufferedDebugDrawWrapper_PackColor(const btVector3& color, btScalar alpha)
+{
+	unsigned int a = (unsigned int)(btClamped(alpha, btScalar(0), btScalar(1)) * 255);
+	unsigned int r = (unsigned int)(btClamped(color.getX(), btScalar(0), btScalar(1)) * 255);
+	unsigned int g = (unsigned int)(btClamped(color.getY(), btScalar(0), btScalar(1)) * 255);
+	unsigned int b = (unsigned int)(btClamped(color.getZ(), btScalar(0), btScalar(1)) * 255);
+	return (int)((a << 24) | (r << 16) | (g << 8) | b);
+}
+
+void BufferedDebugDrawWrapper_SetVertex(BufferedDebugDrawVertex& vertex, const btVector3& position, int color)
+{
+	vertex.x = (float)position.getX();
+	vertex.y = (float)position.getY();
+	vertex.z = (float)position.getZ();
+	vertex.color = color;
+}
+
+// Both points behind the same plane
+bool BufferedDebugDrawWrapper::isLineCulled(const btVector3& from, const btVector3& to) const
+{
+	for (int i = 0; i < m_numPlanes; i++)
+	{
+		const btVector4& plane = m_planes[i];
+		if (plane.dot(from) + plane.getW() < 0 && plane.dot(to) + plane.getW() < 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool BufferedDebugDrawWrapper::isTriangleCulled(const btVector3& v0, const btVector3& v1, const btVector3& v2) const
+{
+	for (int i = 0; i < m_numPlanes; i++)
+	{
+		const btVector4& plane = m_planes[i];
+		if (plane.dot(v0) + plane.getW() < 0 && plane.dot(v1) + plane.getW() < 0 &&
+			plane.dot(v2) + plane.getW() < 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// The corner furthest along the plane normal is behind the plane
+bool BufferedDebugDrawWrapper::isAabbCulled(const btVector3& aabbMin, const btVector3& aabbMax) const
+{
+	for (int i = 0; i < m_numPlanes; i++)
+	{
+		const btVector4& plane = m_planes[i];
+		btVector3 corner(
+			plane.getX() >= 0 ? aabbMax.getX() : aabbMin.getX(),
+			plane.getY() >= 0 ? aabbMax.getY() : aabbMin.getY(),
+			plane.getZ() >= 0 ? aabbMax.getZ() : aabbMin.getZ());
+		if (plane.dot(corner) + plane.getW() < 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void BufferedDebugDrawWrapper::addLine(const btVector3& from, const btVector3& to, const btVector3& fromColor, const btVector3& toColor)
+{
+	if ((m_categories & m_currentCategory) == 0 || isLineCulled(from, to))
+	{
+		return;
+	}
+
+	BufferedDebugDrawWrapper_SetVertex(m_lines.expandNonInitializing(), from, BufferedDebugDrawWrapper_PackColor(fromColor, 1));
+	BufferedDebugDrawWrapper_SetVertex(m_lines.expandNonInitializing(), to, BufferedDebugDrawWrapper_PackColor(toColor, 1));
+}
+
+void BufferedDebugDrawWrapper::draw3dText(const btVector3& location, const char* textString)
+{
+}
+
+void BufferedDebugDrawWrapper::drawAabb(const btVector3& from, const btVector3& to, const btVector3& color)
+{
+	if ((m_categories & CATEGORY_AABBS) == 0 || isAabbCulled(from, to))
+	{
+		return;
+	}
+
+	int previousCategory = m_currentCategory;
+	m_currentCategory = CATEGORY_AABBS;
+	btIDebugDraw::drawAabb(from, to, color);
+	m_currentCategory = previousCategory;
+}
+
+void BufferedDebugDrawWrapper::drawArc(const btVector3& center, const btVector3& normal, const btVector3& axis,
+	btScalar radiusA, btScalar radiusB, btScalar minAngle, btScalar maxAngle,
+	const btVector3& color, bool drawSect, btScalar stepDegrees)
+{
+	btIDebugDraw::drawArc(center, normal, axis, radiusA, radiusB, minAngle, maxAngle, color, drawSect, stepDegrees);
+}
+
+void BufferedDebugDrawWrapper::drawArc(const btVector3& center, const btVector3& normal, const btVector3& axis,
+	btScalar radiusA, btScalar radiusB, btScalar minAngle, btScalar maxAngle,
+	const btVector3& color, bool drawSect)
+{
+	btIDebugDraw::drawArc(center, normal, axis, radiusA, radiusB, minAngle, maxAngle, color, drawSect);
+}
+
+void BufferedDebugDrawWrapper::drawBox(const btVector3& bbMin, const btVector3& bbMax, const btTransform& trans, const btVector3& color)
+{
+	btIDebugDraw::drawBox(bbMin, bbMax, trans, color);
+}
+
+void BufferedDebugDrawWrapper::drawBox(const btVector3& bbMin, const btVector3& bbMax, const btVector3& color)
+{
+	if (isAabbCulled(bbMin, bbMax))
+	{
+		return;
+	}
+	btIDebugDraw::drawBox(bbMin, bbMax, color);
+}
+
+void BufferedDebugDrawWrapper::drawCapsule(btScalar radius, btScalar halfHeight, int upAxis, const btTransform& transform, const btVector3& color)
+{
+	btIDebugDraw::drawCapsule(radius, halfHeight, upAxis, transform, color);
+}
+
+void BufferedDebugDrawWrapper::drawCone(btScalar radius, btScalar height, int upAxis, const btTransform& transform, const btVector3& color)
+{
+	btIDebugDraw::drawCone(radius, height, upAxis, transform, color);
+}
+
+void BufferedDebugDrawWrapper::drawContactPoint(const btVector3& PointOnB, const btVector3& normalOnB, btScalar distance, int lifeTime, const btVector3& color)
+{
+	if ((m_categories & CATEGORY_CONTACT_POINTS) == 0)
+	{
+		return;
+	}
+
+	int previousCategory = m_currentCategory;
+	m_currentCategory = CATEGORY_CONTACT_POINTS;
+	addLine(PointOnB, PointOnB + normalOnB, color, color);
+	m_currentCategory = previousCategory;
+}
+
+void BufferedDebugDrawWrapper::drawCylinder(btScalar radius, btScalar halfHeight, int upAxis, const btTransform& transform, const btVector3& color)
+{
+	btIDebugDraw::drawCylinder(radius, halfHeight, upAxis, transform, color);
+}
+
+void BufferedDebugDrawWrapper::drawLine(const btVector3& from, const btVector3& to, const btVector3& color)
+{
+	addLine(from, to, color, color);
+}
+
+void BufferedDebugDrawWrapper::drawLine(const btVector3& from, const btVector3& to, const btVector3& fromColor, const btVector3& toColor)
+{
+	addLine(from, to, fromColor, toColor);
+}
+
+void BufferedDebugDrawWrapper::drawPlane(const btVector3& planeNormal, btScalar planeConst, const btTransform& transform, const btVector3& color)
+{
+	btIDebugDraw::drawPlane(planeNormal, planeConst, transform, color);
+}
+
+void BufferedDebugDrawWrapper::drawSphere(const btVector3& p, btScalar radius, const btVector3& color)
+{
+	btVector3 extent(radius, radius, radius);
+	if (isAabbCulled(p - extent, p + extent))
+	{
+		return;
+	}
+	btIDebugDraw::drawSphere(p, radius, color);
+}
+
+void BufferedDebugDrawWrapper::drawSphere(btScalar radius, const btTransform& transform, const btVector3& color)
+{
+	btVector3 extent(radius, radius, radius);
+	if (isAabbCulled(transform.getOrigin() - extent, transform.getOrigin() + extent))
+	{
+		return;
+	}
+	btIDebugDraw::drawSphere(radius, transform, color);
+}
+
+void BufferedDebugDrawWrapper::drawSpherePatch(const btVector3& center, const btVector3& up, const btVector3& axis, btScalar radius,
+	btScalar minTh, btScalar maxTh, btScalar minPs, btScalar maxPs, const btVector3& color, btScalar stepDegrees, bool drawCenter)
+{
+	btIDebugDraw::drawSpherePatch(center, up, axis, radius, minTh, maxTh, minPs, maxPs, color, stepDegrees, drawCenter);
+}
+
+void BufferedDebugDrawWrapper::drawSpherePatch(const btVector3& center, const btVector3& up, const btVector3& axis, btScalar radius,
+	btScalar minTh, btScalar maxTh, btScalar minPs, btScalar maxPs, const btVector3& color, btScalar stepDegrees)
+{
+	btIDebugDraw::drawSpherePatch(center, up, axis, radius, minTh, maxTh, minPs, maxPs, color, stepDegrees);
+}
+
+void BufferedDebugDrawWrapper::drawSpherePatch(const btVector3& center, const btVector3& up, const btVector3& axis, btScalar radius,
+	btScalar minTh, btScalar maxTh, btScalar minPs, btScalar maxPs, const btVector3& color)
+{
+	btIDebugDraw::drawSpherePatch(center, up, axis, radius, minTh, maxTh, minPs, maxPs, color);
+}
+
+void BufferedDebugDrawWrapper::drawTransform(const btTransform& transform, btScalar orthoLen)
+{
+	if ((m_categories & CATEGORY_TRANSFORMS) == 0)
+	{
+		return;
+	}
+
+	int previousCategory = m_currentCategory;
+	m_currentCategory = CATEGORY_TRANSFORMS;
+	btIDebugDraw::drawTransform(transform, orthoLen);
+	m_currentCategory = previousCategory;
+}
+
+void BufferedDebugDrawWrapper::drawTriangle(const btVector3& v0, const btVector3& v1, const btVector3& v2, const btVector3& color, btScalar alpha)
+{
+	if ((m_categories & CATEGORY_TRIANGLES) == 0 || isTriangleCulled(v0, v1, v2))
+	{
+		return;
+	}
+
+	int packedColor = BufferedDebugDrawWrapper_PackColor(color, alpha);
+	BufferedDebugDrawWrapper_SetVertex(m_triangles.expandNonInitializing(), v0, packedColor);
+	BufferedDebugDrawWrapper_SetVertex(m_triangles.expandNonInitializing(), v1, packedColor);
+	BufferedDebugDrawWrapper_SetVertex(m_triangles.expandNonInitializing(), v2, packedColor);
+}
+
+void BufferedDebugDrawWrapper::drawTriangle(const btVector3& v0, const btVector3& v1, const btVector3& v2,
+	const btVector3&, const btVector3&, const btVector3&, const btVector3& color, btScalar alpha)
+{
+	drawTriangle(v0, v1, v2, color, alpha);
+}
+
+void BufferedDebugDrawWrapper::flushLines()
+{
+}
+
+void BufferedDebugDrawWrapper::setDebugMode(int debugMode)
+{
+	m_debugMode = debugMode;
+}
+int	BufferedDebugDrawWrapper::getDebugMode() const
+{
+	return m_debugMode;
+}
+#pragma managed(pop)
+
+#endif
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "DebugDraw.h"
+
+namespace BulletSharp
+{
+	class BufferedDebugDrawWrapper;
+
+	// Interleaved position/color vertex as stored by BufferedDebugDraw.
+	// Color is packed as 0xAARRGGBB.
+	[System::Runtime::InteropServices::StructLayout( System::Runtime::InteropServices::LayoutKind::Sequential)]
+	public value struct DebugDrawVertex
+	{
+	public:
+		float X;
+		float Y;
+		float Z;
+		int Color;
+
+		static property int SizeInBytes { int get() { return System::Runtime::InteropServices::Marshal::SizeOf(DebugDrawVertex::typeid); } }
+	};
+
+	// Debug drawer that collects lines and triangles into native vertex buffers
+	// instead of calling back into managed code for every line segment.
+	// Call Clear before CollisionWorld.DebugDrawWorld and read the buffers afterwards.
+	public ref class BufferedDebugDraw : DebugDraw
+	{
+	public:
+		BufferedDebugDraw();
+
+		void Clear();
+		int CopyLineVertices(array<DebugDrawVertex>^% vertices);
+		int CopyTriangleVertices(array<DebugDrawVertex>^% vertices);
+		// Planes are (normal, d) with the inside where dot(normal, p) + d >= 0.
+		// Passing null disables culling.
+		void SetFrustum(array<Vector4>^ planes);
+
+		virtual void Draw3dText(Vector3% location, String^ textString) override;
+		virtual void DrawContactPoint(Vector3% pointOnB, Vector3% normalOnB, btScalar distance, int lifeTime, BtColor color) override;
+		virtual void DrawLine(Vector3% from, Vector3% to, BtColor color) override;
+		virtual void DrawTriangle(Vector3% v0, Vector3% v1, Vector3% v2, BtColor color, btScalar alpha) override;
+		virtual void ReportErrorWarning(String^ warningString) override;
+
+		property DebugDrawCategories Categories
+		{
+			DebugDrawCategories get();
+			void set(DebugDrawCategories value);
+		}
+
+		property DebugDrawModes DebugMode
+		{
+			virtual DebugDrawModes get() override;
+			virtual void set(DebugDrawModes value) override;
+		}
+
+		property int LineVertexCount
+		{
+			int get();
+		}
+
+		// Address of the first line vertex, valid until the next draw call or Clear.
+		property IntPtr LineVertices
+		{
+			IntPtr get();
+		}
+
+		property int TriangleVertexCount
+		{
+			int get();
+		}
+
+		// Address of the first triangle vertex, valid until the next draw call or Clear.
+		property IntPtr TriangleVertices
+		{
+			IntPtr get();
+		}
+	};
+
+	struct BufferedDebugDrawVertex
+	{
+		float x, y, z;
+		int color;
+	};
+
+	// Stays in native code for everything Bullet draws through btIDebugDraw,
+	// the base class implementations break shapes down into drawLine calls.
+	class BufferedDebugDrawWrapper : public DebugDrawWrapper
+	{
+	public:
+		BT_DECLARE_ALIGNED_ALLOCATOR();
+
+		btVector4 m_planes[6];
+		int m_numPlanes;
+		btAlignedObjectArray<BufferedDebugDrawVertex> m_lines;
+		btAlignedObjectArray<BufferedDebugDrawVertex> m_triangles;
+		int m_categories;
+		int m_currentCategory;
+		int m_debugMode;
+
+		BufferedDebugDrawWrapper(IDebugDraw^ debugDraw);
+
+		bool isLineCulled(const btVector3& from, const btVector3& to) const;
+		bool isTriangleCulled(const btVector3& v0, const btVector3& v1, const btVector3& v2) const;
+		bool isAabbCulled(const btVector3& aabbMin, const btVector3& aabbMax) const;
+		void addLine(const btVector3& from, const btVector3& to, const btVector3& fromColor, const btVector3& toColor);
+
+		virtual void draw3dText(const btVector3& location, const char* textString);
+		virtual void drawAabb(const btVector3& from, const btVector3& to, const btVector3& color);
+		virtual void drawArc(const btVector3& center, const btVector3& normal, const btVector3& axis,
+			btScalar radiusA, btScalar radiusB, btScalar minAngle, btScalar maxAngle,
+			const btVector3& color, bool drawSect, btScalar stepDegrees);
+		virtual void drawArc(const btVector3& center, const btVector3& normal, const btVector3& axis,
+			btScalar radiusA, btScalar radiusB, btScalar minAngle, btScalar maxAngle,
+			const btVector3& color, bool drawSect);
+		virtual void drawBox(const btVector3& bbMin, const btVector3& bbMax, const btTransform& trans, const btVector3& color);
+		virtual void drawBox(const btVector3& bbMin, const btVector3& bbMax, const btVector3& color);
+		virtual void drawCapsule(btScalar radius, btScalar halfHeight, int upAxis, const btTransform& transform, const btVector3& color);
+		virtual void drawCone(btScalar radius, btScalar height, int upAxis, const btTransform& transform, const btVector3& color);
+		virtual void drawContactPoint(const btVector3& PointOnB, const btVector3& normalOnB, btScalar distance, int lifeTime, const btVector3& color);
+		virtual void drawCylinder(btScalar radius, btScalar halfHeight, int upAxis, const btTransform& transform, const btVector3& color);
+		virtual void drawLine(const btVector3& from, const btVector3& to, const btVector3& color);
+		virtual void drawLine(const btVector3& from, const btVector3& to, const btVector3& fromColor, const btVector3& toColor);
+		virtual void drawPlane(const btVector3& planeNormal, btScalar planeConst, const btTransform& transform, const btVector3& color);
+		virtual void drawSphere(const btVector3& p, btScalar radius, const btVector3& color);
+		virtual void drawSphere(btScalar radius, const btTransform& transform, const btVector3& color);
+		virtual void drawSpherePatch(const btVector3& center, const btVector3& up, const btVector3& axis, btScalar radius,
+			btScalar minTh, btScalar maxTh, btScalar minPs, btScalar maxPs, const btVector3& color, btScalar stepDegrees, bool drawCenter);
+		virtual void drawSpherePatch(const btVector3& center, const btVector3& up, const btVector3& axis, btScalar radius,
+			btScalar minTh, btScalar maxTh, btScalar minPs, btScalar maxPs, const btVector3& color, btScalar stepDegrees);
+		virtual void drawSpherePatch(const btVector3& center, const btVector3& up, const btVector3& axis, btScalar radius,
+			btScalar minTh, btScalar maxTh, btScalar minPs, btScalar maxPs, const btVector3& color);
+		virtual void drawTransform(const btTransform& transform, btScalar orthoLen);
+		virtual void drawTriangle(const btVector3& v0, const btVector3& v1, const btVector3& v2, const btVector3& color, btScalar);
+		virtual void drawTriangle(const btVector3& v0, const btVector3& v1, const btVector3& v2,
+			const btVector3&, const btVector3&, const btVector3&, const btVector3& color, btScalar alpha);
+
+		virtual void flushLines();
+
+		virtual void setDebugMode(int debugMode);
+		virtual int	getDebugMode() const;
+	};
+};
@@ -404,6 +404,69 @@ bool Serialize::BulletWorldImporter::LoadFileFromMemory(array<Byte>^ memoryBuffe
 	return _native->loadFileFromMemory((char*)memoryBufferPtr, memoryBuffer->Length);
 }
 
+bool Serialize::BulletWorldImporter::LoadFileFromMemory(IntPtr memoryBuffer, int length)
+{
+	return _native->loadFileFromMemory((char*)memoryBuffer.ToPointer(), length);
+}
+
+// Returns a copy-on-write view of the whole file or NULL.
+// The parser swaps the data in place if the file was written with a different endianness,
+// those pages are copied by the OS and the file itself is never modified.
+char* BulletWorldImporter_MapFile(const wchar_t* fileName, int* length)
+{
+	HANDLE file = CreateFileW(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return NULL;
+	}
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0 || size.QuadPart > INT_MAX)
+	{
+		CloseHandle(file);
+		return NULL;
+	}
+
+	// The mapping and the view keep the file open
+	HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+	CloseHandle(file);
+	if (mapping == NULL)
+	{
+		return NULL;
+	}
+
+	char* view = (char*)MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+	CloseHandle(mapping);
+
+	*length = (int)size.QuadPart;
+	return view;
+}
+
+bool Serialize::BulletWorldImporter::LoadFileMapped(String^ fileName)
+{
+	if (fileName == nullptr)
+		throw gcnew ArgumentNullException("fileName");
+
+	pin_ptr<const wchar_t> fileNamePtr = PtrToStringChars(fileName);
+	int length;
+	char* view = BulletWorldImporter_MapFile(fileNamePtr, &length);
+	if (view == NULL)
+	{
+		return false;
+	}
+
+	bool result;
+	try
+	{
+		result = _native->loadFileFromMemory(view, length);
+	}
+	finally
+	{
+		UnmapViewOfFile(view);
+	}
+	return result;
+}
+
 CollisionShape^ Serialize::BulletWorldImporter::GetCollisionShapeByIndex(int index)
 {
 	return _allocatedCollisionShapes[index];
@@ -554,12 +617,233 @@ void Serialize::BulletWorldImporter::VerboseMode::set(int value)
 }
 
 
+Serialize::IncrementalWorldImporter::IncrementalWorldImporter(DynamicsWorld^ world)
+{
+	if (world == nullptr)
+		throw gcnew ArgumentNullException("world");
+
+	_world = world;
+	_importer = gcnew BulletWorldImporter(nullptr);
+#ifndef DISABLE_CONSTRAINTS
+	_importer->_deferredConstraintFlags = gcnew List<bool>();
+#endif
+}
+
+bool Serialize::IncrementalWorldImporter::LoadFile(String^ fileName)
+{
+	return _importer->LoadFile(fileName);
+}
+
+bool Serialize::IncrementalWorldImporter::LoadFileFromMemory(array<Byte>^ memoryBuffer)
+{
+	return _importer->LoadFileFromMemory(memoryBuffer);
+}
+
+bool Serialize::IncrementalWorldImporter::LoadFileFromMemory(IntPtr memoryBuffer, int length)
+{
+	return _importer->LoadFileFromMemory(memoryBuffer, length);
+}
+
+bool Serialize::IncrementalWorldImporter::LoadFileMapped(String^ fileName)
+{
+	return _importer->LoadFileMapped(fileName);
+}
+
+bool Serialize::IncrementalWorldImporter::AddToWorld(int maxObjects, TimeSpan timeBudget)
+{
+	if (maxObjects <= 0)
+		throw gcnew ArgumentOutOfRangeException("maxObjects");
+
+	Stopwatch^ stopwatch = Stopwatch::StartNew();
+	List<CollisionObject^>^ bodies = _importer->_allocatedRigidBodies;
+	int added = 0;
+
+	// Bodies go first so that every constraint finds its bodies in the world
+	while (_bodiesAdded < bodies->Count)
+	{
+		if (added == maxObjects || (added != 0 && stopwatch->Elapsed >= timeBudget))
+			return false;
+
+		CollisionObject^ body = bodies[_bodiesAdded];
+		RigidBody^ rigidBody = RigidBody::Upcast(body);
+		if (rigidBody)
+		{
+			_world->AddRigidBody(rigidBody);
+		}
+		else
+		{
+			_world->AddCollisionObject(body);
+		}
+		_bodiesAdded++;
+		added++;
+	}
+
+#ifndef DISABLE_CONSTRAINTS
+	List<TypedConstraint^>^ constraints = _importer->_allocatedConstraints;
+	List<bool>^ flags = _importer->_deferredConstraintFlags;
+	while (_constraintsAdded < constraints->Count)
+	{
+		if (added == maxObjects || (added != 0 && stopwatch->Elapsed >= timeBudget))
+			return false;
+
+		bool disableCollisions = _constraintsAdded < flags->Count ? flags[_constraintsAdded] : false;
+		_world->AddConstraint(constraints[_constraintsAdded], disableCollisions);
+		_constraintsAdded++;
+		added++;
+	}
+#endif
+
+	return true;
+}
+
+bool Serialize::IncrementalWorldImporter::AddToWorld(int maxObjects)
+{
+	return AddToWorld(maxObjects, TimeSpan::MaxValue);
+}
+
+void Serialize::IncrementalWorldImporter::DeleteAllData()
+{
+	int i;
+
+#ifndef DISABLE_CONSTRAINTS
+	for (i = 0; i < _constraintsAdded; i++)
+	{
+		_world->RemoveConstraint(_importer->_allocatedConstraints[i]);
+	}
+	_importer->_deferredConstraintFlags->Clear();
+#endif
+	_constraintsAdded = 0;
+
+	for (i = 0; i < _bodiesAdded; i++)
+	{
+		CollisionObject^ body = _importer->_allocatedRigidBodies[i];
+		RigidBody^ rigidBody = RigidBody::Upcast(body);
+		if (rigidBody)
+		{
+			_world->RemoveRigidBody(rigidBody);
+		}
+		else
+		{
+			_world->RemoveCollisionObject(body);
+		}
+	}
+	_bodiesAdded = 0;
+
+	_importer->DeleteAllData();
+}
+
+int Serialize::IncrementalWorldImporter::AddedCount::get()
+{
+	return _bodiesAdded + _constraintsAdded;
+}
+
+int Serialize::IncrementalWorldImporter::ObjectCount::get()
+{
+#ifndef DISABLE_CONSTRAINTS
+	return _importer->_allocatedRigidBodies->Count + _importer->_allocatedConstraints->Count;
+#else
+	return _importer->_allocatedRigidBodies->Count;
+#endif
+}
+
+Serialize::BulletWorldImporter^ Serialize::IncrementalWorldImporter::Importer::get()
+{
+	return _importer;
+}
+
+bool Serialize::IncrementalWorldImporter::IsComplete::get()
+{
+	return AddedCount == ObjectCount;
+}
+
+float Serialize::IncrementalWorldImporter::Progress::get()
+{
+	int count = ObjectCount;
+	return count ? (float)AddedCount / count : 1.0f;
+}
+
+
 Serialize::BulletWorldImporterWrapper::BulletWorldImporterWrapper(btDynamicsWorld* world, BulletWorldImporter^ importer)
 : btBulletWorldImporter(world)
 {
 	_importer = importer;
 }
 
+bool Serialize::BulletWorldImporterWrapper::convertAllObjects(bParse::btBulletFile* file)
+{
+#ifndef DISABLE_CONSTRAINTS
+	List<bool>^ flags = _importer->_deferredConstraintFlags;
+	if (flags == nullptr)
+	{
+		return btBulletWorldImporter::convertAllObjects(file);
+	}
+
+	// Without a world the collision flags of the constraints would be lost,
+	// so convert everything else first and then the constraints one at a time.
+	btAlignedObjectArray<bParse::bStructHandle*> constraints = file->m_constraints;
+	file->m_constraints.clear();
+	bool result = btBulletWorldImporter::convertAllObjects(file);
+	file->m_constraints = constraints;
+
+	bool isDoublePrecision = (file->getFlags() & bParse::FD_DOUBLE_PRECISION) != 0;
+	for (int i = 0; i < constraints.size(); i++)
+	{
+		btTypedConstraintData2* constraintData = (btTypedConstraintData2*)constraints[i];
+
+		btCollisionObject** colAPtr = m_bodyMap.find(constraintData->m_rbA);
+		btCollisionObject** colBPtr = m_bodyMap.find(constraintData->m_rbB);
+		btRigidBody* rbA = 0;
+		btRigidBody* rbB = 0;
+		if (colAPtr)
+		{
+			rbA = btRigidBody::upcast(*colAPtr);
+			if (!rbA)
+				rbA = &btTypedConstraint::getFixedBody();
+		}
+		if (colBPtr)
+		{
+			rbB = btRigidBody::upcast(*colBPtr);
+			if (!rbB)
+				rbB = &btTypedConstraint::getFixedBody();
+		}
+		if (!rbA && !rbB)
+			continue;
+
+		int numConstraints = _importer->_allocatedConstraints->Count;
+		bool disableCollisions;
+		if (isDoublePrecision)
+		{
+			if (file->getVersion() >= 282)
+			{
+				btTypedConstraintDoubleData* doubleData = (btTypedConstraintDoubleData*)constraintData;
+				convertConstraintDouble(doubleData, rbA, rbB, file->getVersion());
+				disableCollisions = doubleData->m_disableCollisionsBetweenLinkedBodies != 0;
+			}
+			else
+			{
+				btTypedConstraintData* oldData = (btTypedConstraintData*)constraintData;
+				convertConstraintBackwardsCompatible281(oldData, rbA, rbB, file->getVersion());
+				disableCollisions = oldData->m_disableCollisionsBetweenLinkedBodies != 0;
+			}
+		}
+		else
+		{
+			btTypedConstraintFloatData* floatData = (btTypedConstraintFloatData*)constraintData;
+			convertConstraintFloat(floatData, rbA, rbB, file->getVersion());
+			disableCollisions = floatData->m_disableCollisionsBetweenLinkedBodies != 0;
+		}
+
+		for (int j = numConstraints; j < _importer->_allocatedConstraints->Count; j++)
+		{
+			flags->Add(disableCollisions);
+		}
+	}
+	return result;
+#else
+	return btBulletWorldImporter::convertAllObjects(file);
+#endif
+}
+
 btCollisionObject* Serialize::BulletWorldImporterWrapper::createCollisionObject(const btTransform& startTransform,
 	btCollisionShape* shape, const char* bodyName)
 {
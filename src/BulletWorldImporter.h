@@ -50,6 +50,10 @@ namespace BulletSharp
 			Dictionary<IntPtr, TriangleIndexVertexArray^>^ _allocatedTriangleIndexArraysMap;
 			List<TriangleInfoMap^>^ _allocatedTriangleInfoMaps;
 
+			// Set by IncrementalWorldImporter. Constraints are then converted one by one and
+			// their disableCollisionsBetweenLinkedBodies flags are collected here in creation order.
+			List<bool>^ _deferredConstraintFlags;
+
 		public:
 			!BulletWorldImporter();
 		protected:
@@ -117,6 +121,9 @@ namespace BulletSharp
 			bool LoadFile(String^ fileName, String^ preSwapFilenameOut);
 			bool LoadFile(String^ fileName);
 			bool LoadFileFromMemory(array<Byte>^ memoryBuffer);
+			bool LoadFileFromMemory(IntPtr memoryBuffer, int length);
+			// Maps the file into memory and parses it in place instead of reading it into a buffer first.
+			bool LoadFileMapped(String^ fileName);
 			//bool LoadFileFromMemory(Parse::BulletFile^ file);
 			//bool ConvertAllObjects(Parse::BulletFile^ file);
 
@@ -174,6 +181,62 @@ namespace BulletSharp
 			}
 		};
 
+		// Imports a .bullet file without creating and adding everything in one blocking call.
+		// The Load methods parse the file and create the shapes, bodies and constraints
+		// without touching the world, so they can run on a worker thread.
+		// AddToWorld then adds the created objects to the world in budgeted slices.
+		public ref class IncrementalWorldImporter
+		{
+		private:
+			DynamicsWorld^ _world;
+			BulletWorldImporter^ _importer;
+			int _bodiesAdded;
+			int _constraintsAdded;
+
+		public:
+			IncrementalWorldImporter(DynamicsWorld^ world);
+
+			bool LoadFile(String^ fileName);
+			bool LoadFileFromMemory(array<Byte>^ memoryBuffer);
+			bool LoadFileFromMemory(IntPtr memoryBuffer, int length);
+			bool LoadFileMapped(String^ fileName);
+
+			// Adds up to maxObjects of the loaded objects to the world, bodies before constraints.
+			// Stops early once timeBudget has passed, but always adds at least one object.
+			// Returns true when all loaded objects are in the world.
+			bool AddToWorld(int maxObjects, TimeSpan timeBudget);
+			bool AddToWorld(int maxObjects);
+			// Removes the added objects from the world and deletes everything that was loaded.
+			void DeleteAllData();
+
+			property int AddedCount
+			{
+				int get();
+			}
+
+			property int ObjectCount
+			{
+				int get();
+			}
+
+			// The importer that holds the created objects, use it for queries by index or name.
+			property BulletWorldImporter^ Importer
+			{
+				BulletWorldImporter^ get();
+			}
+
+			property bool IsComplete
+			{
+				bool get();
+			}
+
+			// Fraction of the loaded objects that have been added to the world
+			property float Progress
+			{
+				float get();
+			}
+		};
+
 		class BulletWorldImporterWrapper : public btBulletWorldImporter
 		{
 		private:
@@ -182,6 +245,8 @@ namespace BulletSharp
 		public:
 			BulletWorldImporterWrapper(btDynamicsWorld* world, BulletWorldImporter^ importer);
 
+			virtual bool convertAllObjects(bParse::btBulletFile* file);
+
 			// bodies
 			virtual btCollisionObject* createCollisionObject(const btTransform& startTransform,
 				btCollisionShape* shape, const char* bodyName);
@@ -193,6 +193,12 @@ BvhTriangleMeshShape^ Serialize::BulletXmlWorldImporter::CreateBvhTriangleMeshSh
 		shape->OptimizedBvh = bvh;
 		return shape;
 	}
+	if (_pendingBvhShapes != nullptr)
+	{
+		BvhTriangleMeshShape^ shape = gcnew BvhTriangleMeshShape(trimesh, true, false);
+		_pendingBvhShapes->Add(shape);
+		return shape;
+	}
 	return gcnew BvhTriangleMeshShape(trimesh, true);
 }
 
@@ -380,11 +386,29 @@ void Serialize::BulletXmlWorldImporter::DeleteAllData()
 	_native->deleteAllData();
 }
 
+ref class BvhBuildJob
+{
+internal:
+	List<BvhTriangleMeshShape^>^ _shapes;
+
+	void Run(int index)
+	{
+		_shapes[index]->BuildOptimizedBvh();
+	}
+};
+
 bool Serialize::BulletXmlWorldImporter::LoadFile(String^ filename)
 {
 	const char* filenameTemp = StringConv::ManagedToUnmanaged(filename);
+	_pendingBvhShapes = gcnew List<BvhTriangleMeshShape^>();
 	bool ret = _native->loadFile(filenameTemp);
 	StringConv::FreeUnmanagedString(filenameTemp);
+
+	// Each tree only reads its own mesh interface, so they can be built concurrently
+	BvhBuildJob^ job = gcnew BvhBuildJob();
+	job->_shapes = _pendingBvhShapes;
+	_pendingBvhShapes = nullptr;
+	System::Threading::Tasks::Parallel::For(0, job->_shapes->Count, gcnew Action<int>(job, &BvhBuildJob::Run));
 	return ret;
 }
 
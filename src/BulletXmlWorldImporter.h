@@ -50,6 +50,9 @@ namespace BulletSharp
 			Dictionary<IntPtr, TriangleIndexVertexArray^>^ _allocatedTriangleIndexArraysMap;
 			List<TriangleInfoMap^>^ _allocatedTriangleInfoMaps;
 
+			// Triangle mesh shapes created during LoadFile whose trees are built afterwards
+			List<BvhTriangleMeshShape^>^ _pendingBvhShapes;
+
 		public:
 			!BulletXmlWorldImporter();
 		protected:
@@ -114,6 +117,8 @@ namespace BulletSharp
 #endif
 
 			void DeleteAllData();
+			// Triangle mesh shapes without a stored BVH are created without one during parsing,
+			// their trees are then built in parallel before LoadFile returns.
 			bool LoadFile(String^ fileName);
 
 			// query for data
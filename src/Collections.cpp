@@ -11,6 +11,21 @@
 #include "SoftBody.h"
 #endif
 
+static void CheckCopyRange(int index, Array^ array, int arrayIndex, int count, int length)
+{
+	if (array == nullptr)
+		throw gcnew ArgumentNullException("array");
+
+	if (count < 0)
+		throw gcnew ArgumentOutOfRangeException("count");
+
+	if (index < 0 || index > length - count)
+		throw gcnew ArgumentOutOfRangeException("index");
+
+	if (arrayIndex < 0 || arrayIndex > array->Length - count)
+		throw gcnew ArgumentOutOfRangeException("arrayIndex");
+}
+
 ListDebugView::ListDebugView(System::Collections::IEnumerable^ list)
 {
 	_list = list;
@@ -72,6 +87,36 @@ void ListEnumerator<T>::Reset()
 }
 
 
+generic<class T>
+ListValueEnumerator<T>::ListValueEnumerator(IList<T>^ list)
+{
+	_list = list;
+	_index = -1;
+	_count = list->Count;
+}
+
+generic<class T>
+T ListValueEnumerator<T>::Current::get()
+{
+	return _list[_index];
+}
+
+generic<class T>
+bool ListValueEnumerator<T>::MoveNext()
+{
+	if (_list->Count != _count)
+		throw gcnew InvalidOperationException("Collection was modified; enumeration operation may not execute.");
+	_index++;
+	return (_index < _count);
+}
+
+generic<class T>
+void ListValueEnumerator<T>::Reset()
+{
+	_index = -1;
+}
+
+
 generic<class T>
 GenericList<T>::GenericList(void* array, int length)
 {
@@ -101,7 +146,13 @@ void GenericList<T>::Clear()
 }
 
 generic<class T>
-System::Collections::IEnumerator^ GenericList<T>::GetEnumerator()
+ListValueEnumerator<T> GenericList<T>::GetEnumerator()
+{
+	return ListValueEnumerator<T>(this);
+}
+
+generic<class T>
+System::Collections::IEnumerator^ GenericList<T>::GetObjectEnumerator()
 {
 	return gcnew ListEnumerator<T>(this);
 }
@@ -644,6 +695,34 @@ void FloatArray::CopyTo(array<float>^ array, int arrayIndex)
 	}
 }
 
+FloatArray::Enumerator::Enumerator(FloatArray^ array)
+{
+	_array = array;
+	_index = -1;
+	_count = array->Count;
+}
+
+float FloatArray::Enumerator::Current::get()
+{
+	return static_cast<float*>(_array->_native)[_index];
+}
+
+bool FloatArray::Enumerator::MoveNext()
+{
+	_index++;
+	return (_index < _count);
+}
+
+void FloatArray::Enumerator::Reset()
+{
+	_index = -1;
+}
+
+FloatArray::Enumerator FloatArray::GetEnumerator()
+{
+	return Enumerator(this);
+}
+
 int FloatArray::IndexOf(float item)
 {
 	int i;
@@ -704,6 +783,26 @@ bool IntArray::Contains(int item)
 	return false;
 }
 
+void IntArray::CopyFrom(array<int>^ array)
+{
+	if (array == nullptr)
+		throw gcnew ArgumentNullException("array");
+
+	CopyFrom(0, array, 0, array->Length);
+}
+
+void IntArray::CopyFrom(int index, array<int>^ array, int arrayIndex, int count)
+{
+	if (_isReadOnly)
+		throw gcnew InvalidOperationException("List is read-only.");
+	CheckCopyRange(index, array, arrayIndex, count, _length);
+	if (count == 0)
+		return;
+
+	pin_ptr<int> arrayPtr = &array[arrayIndex];
+	memcpy(&Native[index], arrayPtr, count * sizeof(int));
+}
+
 void IntArray::CopyTo(array<int>^ array, int arrayIndex)
 {
 	if (array == nullptr)
@@ -715,11 +814,45 @@ void IntArray::CopyTo(array<int>^ array, int arrayIndex)
 	if (arrayIndex + _length > array->Length)
 		throw gcnew ArgumentException("Array too small.");
 
-	int i;
-	for (i=0; i<_length; i++)
-	{
-		array[arrayIndex+i] = Native[i];
-	}
+	CopyTo(0, array, arrayIndex, _length);
+}
+
+void IntArray::CopyTo(int index, array<int>^ array, int arrayIndex, int count)
+{
+	CheckCopyRange(index, array, arrayIndex, count, _length);
+	if (count == 0)
+		return;
+
+	pin_ptr<int> arrayPtr = &array[arrayIndex];
+	memcpy(arrayPtr, &Native[index], count * sizeof(int));
+}
+
+IntArray::Enumerator::Enumerator(IntArray^ array)
+{
+	_array = array;
+	_index = -1;
+	_count = array->Count;
+}
+
+int IntArray::Enumerator::Current::get()
+{
+	return static_cast<int*>(_array->_native)[_index];
+}
+
+bool IntArray::Enumerator::MoveNext()
+{
+	_index++;
+	return (_index < _count);
+}
+
+void IntArray::Enumerator::Reset()
+{
+	_index = -1;
+}
+
+IntArray::Enumerator IntArray::GetEnumerator()
+{
+	return Enumerator(this);
 }
 
 int IntArray::IndexOf(int item)
@@ -750,6 +883,11 @@ void IntArray::default::set(int index, int value)
 	Native[index] = value;
 }
 
+IntPtr IntArray::DataPointer::get()
+{
+	return IntPtr(_native);
+}
+
 
 #ifndef DISABLE_SOFTBODY
 
@@ -833,6 +971,26 @@ bool ScalarArray::Contains(btScalar item)
 	return false;
 }
 
+void ScalarArray::CopyFrom(array<btScalar>^ array)
+{
+	if (array == nullptr)
+		throw gcnew ArgumentNullException("array");
+
+	CopyFrom(0, array, 0, array->Length);
+}
+
+void ScalarArray::CopyFrom(int index, array<btScalar>^ array, int arrayIndex, int count)
+{
+	if (_isReadOnly)
+		throw gcnew InvalidOperationException("List is read-only.");
+	CheckCopyRange(index, array, arrayIndex, count, _length);
+	if (count == 0)
+		return;
+
+	pin_ptr<btScalar> arrayPtr = &array[arrayIndex];
+	memcpy(&Native[index], arrayPtr, count * sizeof(btScalar));
+}
+
 void ScalarArray::CopyTo(array<btScalar>^ array, int arrayIndex)
 {
 	if (array == nullptr)
@@ -844,11 +1002,45 @@ void ScalarArray::CopyTo(array<btScalar>^ array, int arrayIndex)
 	if (arrayIndex + _length > array->Length)
 		throw gcnew ArgumentException("Array too small.");
 
-	int i;
-	for (i=0; i<_length; i++)
-	{
-		array[arrayIndex+i] = Native[i];
-	}
+	CopyTo(0, array, arrayIndex, _length);
+}
+
+void ScalarArray::CopyTo(int index, array<btScalar>^ array, int arrayIndex, int count)
+{
+	CheckCopyRange(index, array, arrayIndex, count, _length);
+	if (count == 0)
+		return;
+
+	pin_ptr<btScalar> arrayPtr = &array[arrayIndex];
+	memcpy(arrayPtr, &Native[index], count * sizeof(btScalar));
+}
+
+ScalarArray::Enumerator::Enumerator(ScalarArray^ array)
+{
+	_array = array;
+	_index = -1;
+	_count = array->Count;
+}
+
+btScalar ScalarArray::Enumerator::Current::get()
+{
+	return static_cast<btScalar*>(_array->_native)[_index];
+}
+
+bool ScalarArray::Enumerator::MoveNext()
+{
+	_index++;
+	return (_index < _count);
+}
+
+void ScalarArray::Enumerator::Reset()
+{
+	_index = -1;
+}
+
+ScalarArray::Enumerator ScalarArray::GetEnumerator()
+{
+	return Enumerator(this);
 }
 
 int ScalarArray::IndexOf(btScalar item)
@@ -879,6 +1071,11 @@ void ScalarArray::default::set(int index, btScalar value)
 	Native[index] = value;
 }
 
+IntPtr ScalarArray::DataPointer::get()
+{
+	return IntPtr(_native);
+}
+
 
 #undef Native
 #define Native static_cast<unsigned int*>(_native)
@@ -1047,6 +1244,27 @@ Vector3Array::Vector3Array(int length)
 	_vectorStride = sizeof(btVector3);
 }
 
+void Vector3Array::CopyFrom(array<Vector3>^ array)
+{
+	if (array == nullptr)
+		throw gcnew ArgumentNullException("array");
+
+	CopyFrom(0, array, 0, array->Length);
+}
+
+void Vector3Array::CopyFrom(int index, array<Vector3>^ array, int arrayIndex, int count)
+{
+	if (_isReadOnly)
+		throw gcnew InvalidOperationException("List is read-only.");
+	CheckCopyRange(index, array, arrayIndex, count, _length);
+	if (count == 0)
+		return;
+
+	pin_ptr<Vector3> arrayPtr = &array[arrayIndex];
+	btVector3* p = (btVector3*)(((char*)&Native[0]) + index * _vectorStride);
+	Math::Vector3ArrayToBtVector3Array(arrayPtr, p, _vectorStride, count);
+}
+
 void Vector3Array::CopyTo(array<Vector3>^ array, int arrayIndex)
 {
 	if (array == nullptr)
@@ -1058,13 +1276,47 @@ void Vector3Array::CopyTo(array<Vector3>^ array, int arrayIndex)
 	if (arrayIndex + _length > array->Length)
 		throw gcnew ArgumentException("Array too small.");
 
-	int i;
-	char* p = (char*)&Native[0];
-	for (i=0; i<_length; i++)
-	{
-		Math::BtVector3ToVector3((btVector3*)p, array[arrayIndex+i]);
-		p += _vectorStride;
-	}
+	CopyTo(0, array, arrayIndex, _length);
+}
+
+void Vector3Array::CopyTo(int index, array<Vector3>^ array, int arrayIndex, int count)
+{
+	CheckCopyRange(index, array, arrayIndex, count, _length);
+	if (count == 0)
+		return;
+
+	pin_ptr<Vector3> arrayPtr = &array[arrayIndex];
+	btVector3* p = (btVector3*)(((char*)&Native[0]) + index * _vectorStride);
+	Math::BtVector3ArrayToVector3Array(p, _vectorStride, arrayPtr, count);
+}
+
+Vector3Array::Enumerator::Enumerator(Vector3Array^ array)
+{
+	_array = array;
+	_index = -1;
+	_count = array->Count;
+}
+
+Vector3 Vector3Array::Enumerator::Current::get()
+{
+	btVector3* p = (btVector3*)(((char*)_array->_native) + _index * _array->_vectorStride);
+	return Math::BtVector3ToVector3(p);
+}
+
+bool Vector3Array::Enumerator::MoveNext()
+{
+	_index++;
+	return (_index < _count);
+}
+
+void Vector3Array::Enumerator::Reset()
+{
+	_index = -1;
+}
+
+Vector3Array::Enumerator Vector3Array::GetEnumerator()
+{
+	return Enumerator(this);
 }
 
 int Vector3Array::IndexOf(Vector3 item)
@@ -1105,6 +1357,11 @@ void Vector3Array::default::set(int index, Vector3 value)
 	Math::Vector3ToBtVector3(value, p);
 }
 
+IntPtr Vector3Array::DataPointer::get()
+{
+	return IntPtr(_native);
+}
+
 int Vector3Array::Stride::get()
 {
 	return _vectorStride;
@@ -64,6 +64,29 @@ namespace BulletSharp
 		virtual void Reset();
 	};
 
+	// Enumerator returned by the GetEnumerator method of the collection classes.
+	// It is a value type, so foreach loops over a collection don't allocate.
+	generic<class T>
+	public value struct ListValueEnumerator
+	{
+	private:
+		IList<T>^ _list;
+		int _index;
+		int _count;
+
+	internal:
+		ListValueEnumerator(IList<T>^ list);
+
+	public:
+		property T Current
+		{
+			T get();
+		}
+
+		bool MoveNext();
+		void Reset();
+	};
+
 	generic<class T>
 	public ref class GenericList abstract : IList<T>
 	{
@@ -83,7 +106,8 @@ namespace BulletSharp
 		virtual void Clear();
 		virtual bool Contains(T item);
 		virtual void CopyTo(array<T>^ array, int arrayIndex) = 0;
-		virtual System::Collections::IEnumerator^ GetEnumerator() = System::Collections::IEnumerable::GetEnumerator;
+		ListValueEnumerator<T> GetEnumerator();
+		virtual System::Collections::IEnumerator^ GetObjectEnumerator() = System::Collections::IEnumerable::GetEnumerator;
 		virtual IEnumerator<T>^ GetSpecializedEnumerator() = IEnumerable<T>::GetEnumerator;
 		virtual int IndexOf(T item);
 		virtual void Insert(int index, T item);
@@ -250,8 +274,31 @@ namespace BulletSharp
 	public:
 		FloatArray(int length);
 
+		// Reads the native array without going through IList.
+		// The length of the view is fixed, so no modification check is needed.
+		value struct Enumerator
+		{
+		private:
+			FloatArray^ _array;
+			int _index;
+			int _count;
+
+		internal:
+			Enumerator(FloatArray^ array);
+
+		public:
+			property float Current
+			{
+				float get();
+			}
+
+			bool MoveNext();
+			void Reset();
+		};
+
 		virtual bool Contains(float item) override;
 		virtual void CopyTo(array<float>^ array, int arrayIndex) override;
+		Enumerator GetEnumerator();
 		virtual int IndexOf(float item) override;
 
 		property float default[int]
@@ -272,8 +319,33 @@ namespace BulletSharp
 	public:
 		IntArray(int length);
 
+		// Reads the native array directly, see FloatArray::Enumerator
+		value struct Enumerator
+		{
+		private:
+			IntArray^ _array;
+			int _index;
+			int _count;
+
+		internal:
+			Enumerator(IntArray^ array);
+
+		public:
+			property int Current
+			{
+				int get();
+			}
+
+			bool MoveNext();
+			void Reset();
+		};
+
 		virtual bool Contains(int item) override;
+		void CopyFrom(array<int>^ array);
+		void CopyFrom(int index, array<int>^ array, int arrayIndex, int count);
 		virtual void CopyTo(array<int>^ array, int arrayIndex) override;
+		void CopyTo(int index, array<int>^ array, int arrayIndex, int count);
+		Enumerator GetEnumerator();
 		virtual int IndexOf(int item) override;
 
 		property int default[int]
@@ -281,6 +353,12 @@ namespace BulletSharp
 			virtual int get(int index) override;
 			virtual void set(int index, int value) override;
 		}
+
+		// Address of the first element, valid as long as the owning object.
+		property IntPtr DataPointer
+		{
+			IntPtr get();
+		}
 	};
 
 #ifndef DISABLE_SOFTBODY
@@ -319,8 +397,33 @@ namespace BulletSharp
 	public:
 		ScalarArray(int length);
 
+		// Reads the native array directly, see FloatArray::Enumerator
+		value struct Enumerator
+		{
+		private:
+			ScalarArray^ _array;
+			int _index;
+			int _count;
+
+		internal:
+			Enumerator(ScalarArray^ array);
+
+		public:
+			property btScalar Current
+			{
+				btScalar get();
+			}
+
+			bool MoveNext();
+			void Reset();
+		};
+
 		virtual bool Contains(btScalar item) override;
+		void CopyFrom(array<btScalar>^ array);
+		void CopyFrom(int index, array<btScalar>^ array, int arrayIndex, int count);
 		virtual void CopyTo(array<btScalar>^ array, int arrayIndex) override;
+		void CopyTo(int index, array<btScalar>^ array, int arrayIndex, int count);
+		Enumerator GetEnumerator();
 		virtual int IndexOf(btScalar item) override;
 
 		property btScalar default[int]
@@ -328,6 +431,12 @@ namespace BulletSharp
 			virtual btScalar get(int index) override;
 			virtual void set(int index, btScalar value) override;
 		}
+
+		// Address of the first element, valid as long as the owning object.
+		property IntPtr DataPointer
+		{
+			IntPtr get();
+		}
 	};
 
 	[DebuggerDisplay("Count = {Count}")]
@@ -384,7 +493,32 @@ namespace BulletSharp
 	public:
 		Vector3Array(int length);
 
+		// Reads the native array directly, see FloatArray::Enumerator
+		value struct Enumerator
+		{
+		private:
+			Vector3Array^ _array;
+			int _index;
+			int _count;
+
+		internal:
+			Enumerator(Vector3Array^ array);
+
+		public:
+			property Vector3 Current
+			{
+				Vector3 get();
+			}
+
+			bool MoveNext();
+			void Reset();
+		};
+
+		void CopyFrom(array<Vector3>^ array);
+		void CopyFrom(int index, array<Vector3>^ array, int arrayIndex, int count);
 		virtual void CopyTo(array<Vector3>^ array, int arrayIndex) override;
+		void CopyTo(int index, array<Vector3>^ array, int arrayIndex, int count);
+		Enumerator GetEnumerator();
 		virtual int IndexOf(Vector3 item) override;
 
 		property Vector3 default[int]
@@ -393,6 +527,12 @@ namespace BulletSharp
 			virtual void set(int index, Vector3 value) override;
 		}
 
+		// Address of the first element, valid as long as the owning object.
+		property IntPtr DataPointer
+		{
+			IntPtr get();
+		}
+
 		property int Stride
 		{
 			int get();
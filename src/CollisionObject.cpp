@@ -3,6 +3,10 @@
 #include "BroadphaseProxy.h"
 #include "CollisionObject.h"
 #include "CollisionShape.h"
+#ifndef DISABLE_DBVT
+#include "DbvtBroadphase.h"
+#endif
+#include "SimpleBroadphase.h"
 #include "RigidBody.h"
 #ifndef DISABLE_FEATHERSTONE
 #include "MultiBodyLinkCollider.h"
@@ -163,8 +167,35 @@ void CollisionObject::AnisotropicFriction::set(Vector3 value)
 	VECTOR3_DEL(value);
 }
 
+BroadphaseProxy^ CollisionObject_CreateBroadphaseHandle(btBroadphaseProxy* handle, btBroadphaseInterface* broadphase)
+{
+#ifndef DISABLE_DBVT
+	if (dynamic_cast<btDbvtBroadphase*>(broadphase)) {
+		return gcnew DbvtProxy((btDbvtProxy*)handle);
+	}
+#endif
+	// TODO: implement AxisSweep3::Handle
+	if (dynamic_cast<btSimpleBroadphase*>(broadphase)) {
+		return gcnew SimpleBroadphaseProxy((btSimpleBroadphaseProxy*)handle);
+	}
+	return gcnew BroadphaseProxy(handle);
+}
+
 BroadphaseProxy^ CollisionObject::BroadphaseHandle::get()
 {
+	// The wrapper is only created when first requested,
+	// adding objects to a world doesn't allocate one per object.
+	btBroadphaseProxy* handle = _native->getBroadphaseHandle();
+	if (handle == 0)
+	{
+		// A cached wrapper would point to the proxy freed when the object left the world
+		_broadphaseHandle = nullptr;
+		return nullptr;
+	}
+	if (_broadphaseHandle == nullptr || _broadphaseHandle->_native != handle)
+	{
+		_broadphaseHandle = CollisionObject_CreateBroadphaseHandle(handle, _broadphase);
+	}
 	return _broadphaseHandle;
 }
 void CollisionObject::BroadphaseHandle::set(BroadphaseProxy^ handle)
@@ -369,6 +400,11 @@ void CollisionObject::UserIndex::set(int index)
 	_native->setUserIndex(index);
 }
 
+int CollisionObject::WorldHandle::get()
+{
+	return _worldHandle;
+}
+
 Object^ CollisionObject::UserObject::get()
 {
 	return _userObject;
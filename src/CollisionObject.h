@@ -15,6 +15,8 @@ namespace BulletSharp
 	internal:
 		btCollisionObject* _native;
 		bool _preventDelete;
+		int _worldHandle;
+		btBroadphaseInterface* _broadphase;
 
 	private:
 		bool _isDisposed;
@@ -218,6 +220,14 @@ namespace BulletSharp
 			void set(int index);
 		}
 
+		// Integer id assigned by the world while the object is in it, 0 otherwise.
+		// Ids of removed objects are reused after their generation bits change,
+		// so a stale id doesn't find a different object.
+		property int WorldHandle
+		{
+			int get();
+		}
+
 		// UserPointer implemented as UserObject
 		property Object^ UserObject
 		{
@@ -79,18 +79,16 @@ CollisionShape::!CollisionShape()
 
 void CollisionShape::CalculateLocalInertia(btScalar mass, [Out] Vector3% inertia)
 {
-	btVector3* inertiaTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, inertiaTemp);
 	_native->calculateLocalInertia(mass, *inertiaTemp);
 	Math::BtVector3ToVector3(inertiaTemp, inertia);
-	ALIGNED_FREE(inertiaTemp);
 }
 
 Vector3 CollisionShape::CalculateLocalInertia(btScalar mass)
 {
-	btVector3* inertiaTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, inertiaTemp);
 	_native->calculateLocalInertia(mass, *inertiaTemp);
 	Vector3 inertia = Math::BtVector3ToVector3(inertiaTemp);
-	ALIGNED_FREE(inertiaTemp);
 	return inertia;
 }
 
@@ -107,8 +105,8 @@ void CollisionShape::CalculateTemporalAabb(Matrix% curTrans, Vector3% linvel, Ve
 	TRANSFORM_CONV(curTrans);
 	VECTOR3_CONV(linvel);
 	VECTOR3_CONV(angvel);
-	btVector3* temporalAabbMinTemp = ALIGNED_NEW(btVector3);
-	btVector3* temporalAabbMaxTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, temporalAabbMinTemp);
+	ALIGNED_STACK(btVector3, temporalAabbMaxTemp);
 	_native->calculateTemporalAabb(TRANSFORM_USE(curTrans), VECTOR3_USE(linvel), VECTOR3_USE(angvel),
 		timeStep, *temporalAabbMinTemp,	*temporalAabbMaxTemp);
 	Math::BtVector3ToVector3(temporalAabbMaxTemp, temporalAabbMin);
@@ -116,8 +114,6 @@ void CollisionShape::CalculateTemporalAabb(Matrix% curTrans, Vector3% linvel, Ve
 	TRANSFORM_DEL(curTrans);
 	VECTOR3_DEL(linvel);
 	VECTOR3_DEL(angvel);
-	ALIGNED_FREE(temporalAabbMinTemp);
-	ALIGNED_FREE(temporalAabbMaxTemp);
 }
 
 void CollisionShape::CalculateTemporalAabb(Matrix curTrans, Vector3 linvel, Vector3 angvel,
@@ -126,8 +122,8 @@ void CollisionShape::CalculateTemporalAabb(Matrix curTrans, Vector3 linvel, Vect
 	TRANSFORM_CONV(curTrans);
 	VECTOR3_CONV(linvel);
 	VECTOR3_CONV(angvel);
-	btVector3* temporalAabbMinTemp = ALIGNED_NEW(btVector3);
-	btVector3* temporalAabbMaxTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, temporalAabbMinTemp);
+	ALIGNED_STACK(btVector3, temporalAabbMaxTemp);
 	_native->calculateTemporalAabb(TRANSFORM_USE(curTrans), VECTOR3_USE(linvel), VECTOR3_USE(angvel),
 		timeStep, *temporalAabbMinTemp,	*temporalAabbMaxTemp);
 	Math::BtVector3ToVector3(temporalAabbMaxTemp, temporalAabbMin);
@@ -135,8 +131,6 @@ void CollisionShape::CalculateTemporalAabb(Matrix curTrans, Vector3 linvel, Vect
 	TRANSFORM_DEL(curTrans);
 	VECTOR3_DEL(linvel);
 	VECTOR3_DEL(angvel);
-	ALIGNED_FREE(temporalAabbMinTemp);
-	ALIGNED_FREE(temporalAabbMaxTemp);
 }
 
 bool CollisionShape::Equals(Object^ obj)
@@ -147,39 +141,34 @@ bool CollisionShape::Equals(Object^ obj)
 void CollisionShape::GetAabb(Matrix% t, [Out] Vector3% aabbMin, [Out] Vector3% aabbMax)
 {
 	TRANSFORM_CONV(t);
-	btVector3* aabbMinTemp = ALIGNED_NEW(btVector3);
-	btVector3* aabbMaxTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, aabbMinTemp);
+	ALIGNED_STACK(btVector3, aabbMaxTemp);
 	_native->getAabb(TRANSFORM_USE(t), *aabbMinTemp, *aabbMaxTemp);
 	Math::BtVector3ToVector3(aabbMinTemp, aabbMin);
 	Math::BtVector3ToVector3(aabbMaxTemp, aabbMax);
 	TRANSFORM_DEL(t);
-	ALIGNED_FREE(aabbMinTemp);
-	ALIGNED_FREE(aabbMaxTemp);
 }
 
 void CollisionShape::GetAabb(Matrix t, [Out] Vector3% aabbMin, [Out] Vector3% aabbMax)
 {
 	TRANSFORM_CONV(t);
-	btVector3* aabbMinTemp = ALIGNED_NEW(btVector3);
-	btVector3* aabbMaxTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, aabbMinTemp);
+	ALIGNED_STACK(btVector3, aabbMaxTemp);
 	_native->getAabb(TRANSFORM_USE(t), *aabbMinTemp, *aabbMaxTemp);
 	Math::BtVector3ToVector3(aabbMinTemp, aabbMin);
 	Math::BtVector3ToVector3(aabbMaxTemp, aabbMax);
 	TRANSFORM_DEL(t);
-	ALIGNED_FREE(aabbMinTemp);
-	ALIGNED_FREE(aabbMaxTemp);
 }
 
 void CollisionShape::GetBoundingSphere([Out] Vector3% center, [Out] btScalar% radius)
 {
-	btVector3* centerTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, centerTemp);
 	btScalar radiusTemp;
 	
 	_native->getBoundingSphere(*centerTemp, radiusTemp);
 	
 	center = Math::BtVector3ToVector3(centerTemp);
 	radius = radiusTemp;
-	ALIGNED_FREE(centerTemp);
 }
 
 btScalar CollisionShape::GetContactBreakingThreshold(btScalar defaultContactThresholdFactor)
@@ -217,10 +206,9 @@ void CollisionShape_AnisotropicRollingFrictionDirection(btCollisionShape* shape,
 #pragma managed(pop)
 Vector3 CollisionShape::AnisotropicRollingFrictionDirection::get()
 {
-	btVector3* retTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, retTemp);
 	CollisionShape_AnisotropicRollingFrictionDirection(_native, retTemp);
 	Vector3 ret = Math::BtVector3ToVector3(retTemp);
-	ALIGNED_FREE(retTemp);
 	return ret;
 }
 
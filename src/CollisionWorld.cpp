@@ -160,6 +160,11 @@ bool RayResultCallback::NeedsCollisionUnmanaged(IntPtr proxy0)
 	return NeedsCollision(BroadphaseProxy::GetManaged(static_cast<btBroadphaseProxy*>(proxy0.ToPointer())));
 }
 
+RayResultCallback::RayResultCallback(btCollisionWorld::RayResultCallback* native)
+{
+	_native = native;
+}
+
 RayResultCallback::RayResultCallback()
 {
 	_addSingleResult = gcnew AddSingleResultUnmanagedDelegate(this, &RayResultCallback::AddSingleResultUnmanaged);
@@ -296,18 +301,16 @@ btScalar AllHitsRayResultCallback::AddSingleResult(LocalRayResult^ rayResult, bo
 {
 	CollisionObject = rayResult->CollisionObject;
 	CollisionObjects->Add(CollisionObject);
-	btVector3* hitNormalWorldTemp = ALIGNED_NEW(btVector3);
-	btVector3* hitPointWorldTemp = ALIGNED_NEW(btVector3);
-	btVector3* rayFromWorld = Math::Vector3ToBtVector3(RayFromWorld);
-	btVector3* rayToWorld = Math::Vector3ToBtVector3(RayToWorld);
+	ALIGNED_STACK(btVector3, hitNormalWorldTemp);
+	ALIGNED_STACK(btVector3, hitPointWorldTemp);
+	ALIGNED_STACK(btVector3, rayFromWorld);
+	Math::Vector3ToBtVector3(RayFromWorld, rayFromWorld);
+	ALIGNED_STACK(btVector3, rayToWorld);
+	Math::Vector3ToBtVector3(RayToWorld, rayToWorld);
 	RayResultCallback_AddSingleResult(rayResult->_native, normalInWorldSpace,
 		rayFromWorld, rayToWorld, hitNormalWorldTemp, hitPointWorldTemp);
 	HitNormalWorld->Add(Math::BtVector3ToVector3(hitNormalWorldTemp));
 	HitPointWorld->Add(Math::BtVector3ToVector3(hitPointWorldTemp));
-	ALIGNED_FREE(hitNormalWorldTemp);
-	ALIGNED_FREE(hitPointWorldTemp);
-	ALIGNED_FREE(rayFromWorld);
-	ALIGNED_FREE(rayToWorld);
 	HitFractions->Add(rayResult->HitFraction);
 	return ClosestHitFraction;
 }
@@ -444,6 +447,11 @@ ConvexResultCallback::!ConvexResultCallback()
 	_native = NULL;
 }
 
+ConvexResultCallback::ConvexResultCallback(btCollisionWorld::ConvexResultCallback* native)
+{
+	_native = native;
+}
+
 ConvexResultCallback::ConvexResultCallback()
 {
 	_native = ALIGNED_NEW(ConvexResultCallbackWrapper) (this);
@@ -554,11 +562,10 @@ btScalar ClosestConvexResultCallback::AddSingleResult(LocalConvexResult^ convexR
 
 	ClosestHitFraction = convexResult->HitFraction;
 	_hitCollisionObject = convexResult->HitCollisionObject;
-	btVector3* hitNormalWorldTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, hitNormalWorldTemp);
 	ClosestConvexResultCallback_AddSingleResult(convexResult->_native, normalInWorldSpace,
 		hitNormalWorldTemp);
 	Math::BtVector3ToVector3(hitNormalWorldTemp, _hitNormalWorld);
-	ALIGNED_FREE(hitNormalWorldTemp);
 	_hitPointWorld = convexResult->HitPointLocal;
 	return convexResult->HitFraction;
 }
@@ -630,18 +637,16 @@ btScalar ClosestRayResultCallback::AddSingleResult(LocalRayResult^ rayResult, bo
 
 	ClosestHitFraction = rayResult->HitFraction;
 	CollisionObject = rayResult->CollisionObject;
-	btVector3* hitNormalWorldTemp = ALIGNED_NEW(btVector3);
-	btVector3* hitPointWorldTemp = ALIGNED_NEW(btVector3);
-	btVector3* rayFromWorld = Math::Vector3ToBtVector3(_rayFromWorld);
-	btVector3* rayToWorld = Math::Vector3ToBtVector3(_rayToWorld);
+	ALIGNED_STACK(btVector3, hitNormalWorldTemp);
+	ALIGNED_STACK(btVector3, hitPointWorldTemp);
+	ALIGNED_STACK(btVector3, rayFromWorld);
+	Math::Vector3ToBtVector3(_rayFromWorld, rayFromWorld);
+	ALIGNED_STACK(btVector3, rayToWorld);
+	Math::Vector3ToBtVector3(_rayToWorld, rayToWorld);
 	RayResultCallback_AddSingleResult(rayResult->_native, normalInWorldSpace,
 		rayFromWorld, rayToWorld, hitNormalWorldTemp, hitPointWorldTemp);
 	Math::BtVector3ToVector3(hitNormalWorldTemp, _hitNormalWorld);
 	Math::BtVector3ToVector3(hitPointWorldTemp, _hitPointWorld);
-	ALIGNED_FREE(hitNormalWorldTemp);
-	ALIGNED_FREE(hitPointWorldTemp);
-	ALIGNED_FREE(rayFromWorld);
-	ALIGNED_FREE(rayToWorld);
 	return rayResult->HitFraction;
 }
 
@@ -682,256 +687,1804 @@ void ClosestRayResultCallback::RayToWorld::set(Vector3 value)
 }
 
 
-ContactResultCallback::~ContactResultCallback()
+#pragma managed(push, off)
+NativeCollisionObjectFilter::NativeCollisionObjectFilter()
+	: m_objectFilterMode(0), m_userIndex(-1), m_userIndexFilterMode(0)
 {
-	this->!ContactResultCallback();
 }
 
-ContactResultCallback::!ContactResultCallback()
+// Filter modes are CollisionObjectFilterMode values: 0 - Disabled, 1 - Exclude, 2 - IncludeOnly
+bool NativeCollisionObjectFilter::passes(const btCollisionObject* collisionObject) const
 {
-	if (this->IsDisposed)
-		return;
-	
-	delete _native;
-	_native = NULL;
+	if (m_objectFilterMode != 0)
+	{
+		bool inSet = m_objects.findBinarySearch(collisionObject) != m_objects.size();
+		if (inSet != (m_objectFilterMode == 2))
+			return false;
+	}
+	if (m_userIndexFilterMode != 0)
+	{
+		bool matches = collisionObject->getUserIndex() == m_userIndex;
+		if (matches != (m_userIndexFilterMode == 2))
+			return false;
+	}
+	return true;
 }
 
-ContactResultCallback::ContactResultCallback()
+struct CollisionObjectPointerLess
 {
-	_native = new ContactResultCallbackWrapper(this);
-}
+	bool operator()(const btCollisionObject* a, const btCollisionObject* b) const
+	{
+		return a < b;
+	}
+};
 
-bool ContactResultCallback::NeedsCollision(BroadphaseProxy^ proxy0)
+void NativeCollisionObjectFilter::sortObjects()
 {
-	bool collides = (proxy0->CollisionFilterGroup & CollisionFilterMask) != CollisionFilterGroups::None;
-	collides = collides && (CollisionFilterGroup & proxy0->CollisionFilterMask) != CollisionFilterGroups::None;
-	return collides;
+	m_objects.quickSort(CollisionObjectPointerLess());
 }
 
-CollisionFilterGroups ContactResultCallback::CollisionFilterGroup::get()
-{
-	return (CollisionFilterGroups)_native->m_collisionFilterGroup;
-}
-void ContactResultCallback::CollisionFilterGroup::set(CollisionFilterGroups value)
+bool NativeResultFilter::needsCollision(const btBroadphaseProxy* proxy0) const
 {
-	_native->m_collisionFilterGroup = (short int)value;
+	const btCollisionObject* collisionObject = (const btCollisionObject*)proxy0->m_clientObject;
+	if (collisionObject == m_ignoredObject)
+		return false;
+	return m_filter == 0 || m_filter->passes(collisionObject);
 }
 
-CollisionFilterGroups ContactResultCallback::CollisionFilterMask::get()
+class ClosestRayResultCallbackPreset : public btCollisionWorld::ClosestRayResultCallback
 {
-	return (CollisionFilterGroups)_native->m_collisionFilterMask;
-}
-void ContactResultCallback::CollisionFilterMask::set(CollisionFilterGroups value)
+public:
+	BT_DECLARE_ALIGNED_ALLOCATOR();
+
+	NativeResultFilter m_resultFilter;
+	bool m_anyHit;
+
+	ClosestRayResultCallbackPreset(const btVector3& rayFromWorld, const btVector3& rayToWorld, bool anyHit)
+		: btCollisionWorld::ClosestRayResultCallback(rayFromWorld, rayToWorld), m_anyHit(anyHit)
+	{
+		m_resultFilter.m_ignoredObject = 0;
+		m_resultFilter.m_filter = 0;
+	}
+
+	virtual bool needsCollision(btBroadphaseProxy* proxy0) const
+	{
+		return btCollisionWorld::ClosestRayResultCallback::needsCollision(proxy0) &&
+			m_resultFilter.needsCollision(proxy0);
+	}
+
+	virtual btScalar addSingleResult(btCollisionWorld::LocalRayResult& rayResult, bool normalInWorldSpace)
+	{
+		btScalar hitFraction = btCollisionWorld::ClosestRayResultCallback::addSingleResult(rayResult, normalInWorldSpace);
+		if (m_anyHit)
+		{
+			// The broadphase stops traversing once the closest hit fraction is zero
+			m_closestHitFraction = 0;
+			return 0;
+		}
+		return hitFraction;
+	}
+};
+
+class AllHitsRayResultCallbackPreset : public btCollisionWorld::AllHitsRayResultCallback
 {
-	_native->m_collisionFilterMask = (short int)value;
-}
+public:
+	BT_DECLARE_ALIGNED_ALLOCATOR();
 
-bool ContactResultCallback::IsDisposed::get()
+	NativeResultFilter m_resultFilter;
+
+	AllHitsRayResultCallbackPreset(const btVector3& rayFromWorld, const btVector3& rayToWorld)
+		: btCollisionWorld::AllHitsRayResultCallback(rayFromWorld, rayToWorld)
+	{
+		m_resultFilter.m_ignoredObject = 0;
+		m_resultFilter.m_filter = 0;
+	}
+
+	virtual bool needsCollision(btBroadphaseProxy* proxy0) const
+	{
+		return btCollisionWorld::AllHitsRayResultCallback::needsCollision(proxy0) &&
+			m_resultFilter.needsCollision(proxy0);
+	}
+};
+
+class ClosestConvexResultCallbackPreset : public btCollisionWorld::ClosestConvexResultCallback
 {
-	return (_native == NULL);
-}
+public:
+	BT_DECLARE_ALIGNED_ALLOCATOR();
 
+	NativeResultFilter m_resultFilter;
+	bool m_anyHit;
 
-#undef Callback
-#define Callback static_cast<BulletSharp::ContactResultCallback^>(VoidPtrToGCHandle(_callback).Target)
+	ClosestConvexResultCallbackPreset(const btVector3& convexFromWorld, const btVector3& convexToWorld, bool anyHit)
+		: btCollisionWorld::ClosestConvexResultCallback(convexFromWorld, convexToWorld), m_anyHit(anyHit)
+	{
+		m_resultFilter.m_ignoredObject = 0;
+		m_resultFilter.m_filter = 0;
+	}
 
-ContactResultCallbackWrapper::ContactResultCallbackWrapper(BulletSharp::ContactResultCallback^ callback)
+	virtual bool needsCollision(btBroadphaseProxy* proxy0) const
+	{
+		return btCollisionWorld::ClosestConvexResultCallback::needsCollision(proxy0) &&
+			m_resultFilter.needsCollision(proxy0);
+	}
+
+	virtual btScalar addSingleResult(btCollisionWorld::LocalConvexResult& convexResult, bool normalInWorldSpace)
+	{
+		btScalar hitFraction = btCollisionWorld::ClosestConvexResultCallback::addSingleResult(convexResult, normalInWorldSpace);
+		if (m_anyHit)
+		{
+			// The broadphase stops traversing once the closest hit fraction is zero
+			m_closestHitFraction = 0;
+			return 0;
+		}
+		return hitFraction;
+	}
+};
+#pragma managed(pop)
+
+
+CollisionObjectFilter::~CollisionObjectFilter()
 {
-	_callback = GCHandleToVoidPtr(GCHandle::Alloc(callback, GCHandleType::Weak));
+	this->!CollisionObjectFilter();
 }
 
-ContactResultCallbackWrapper::~ContactResultCallbackWrapper()
+CollisionObjectFilter::!CollisionObjectFilter()
 {
-	VoidPtrToGCHandle(_callback).Free();
+	delete _native;
+	_native = NULL;
 }
 
-bool ContactResultCallbackWrapper::needsCollision(btBroadphaseProxy* proxy0) const
+CollisionObjectFilter::CollisionObjectFilter()
 {
-	return Callback->NeedsCollision(BroadphaseProxy::GetManaged(proxy0));
+	_native = new NativeCollisionObjectFilter();
 }
 
-btScalar ContactResultCallbackWrapper::addSingleResult(btManifoldPoint& cp,
-	const btCollisionObjectWrapper* colObj0Wrap, int partId0, int index0,
-	const btCollisionObjectWrapper* colObj1Wrap, int partId1, int index1)
+void CollisionObjectFilter::SetObjects(array<BulletSharp::CollisionObject^>^ objects, CollisionObjectFilterMode mode)
 {
-	return Callback->AddSingleResult(gcnew ManifoldPoint(&cp, true),
-		gcnew CollisionObjectWrapper((btCollisionObjectWrapper*)colObj0Wrap), partId0, index0,
-		gcnew CollisionObjectWrapper((btCollisionObjectWrapper*)colObj1Wrap), partId1, index1);
+	if (objects == nullptr)
+	{
+		_native->m_objects.resize(0);
+	}
+	else
+	{
+		int numObjects = objects->Length;
+		_native->m_objects.resize(numObjects);
+		for (int i = 0; i < numObjects; i++)
+		{
+			if (objects[i] == nullptr)
+				throw gcnew ArgumentNullException("objects");
+			_native->m_objects[i] = objects[i]->_native;
+		}
+		_native->sortObjects();
+	}
+	_native->m_objectFilterMode = (int)mode;
 }
 
+void CollisionObjectFilter::SetUserIndex(int userIndex, CollisionObjectFilterMode mode)
+{
+	_native->m_userIndex = userIndex;
+	_native->m_userIndexFilterMode = (int)mode;
+}
 
-CollisionWorld::CollisionWorld(btCollisionWorld* native)
+bool CollisionObjectFilter::IsDisposed::get()
 {
-	if (!native) {
-		return;
-	}
-	_native = native;
-	_collisionObjectArray = gcnew AlignedCollisionObjectArray(&_native->getCollisionObjectArray(), native);
+	return (_native == NULL);
 }
 
-CollisionWorld::CollisionWorld(BulletSharp::Dispatcher^ dispatcher, BroadphaseInterface^ broadphasePairCache,
-	BulletSharp::CollisionConfiguration^ collisionConfiguration)
+int CollisionObjectFilter::NumObjects::get()
 {
-	_native = new btCollisionWorld(dispatcher->_native, broadphasePairCache->_native,
-		collisionConfiguration->_native);
-	_collisionObjectArray = gcnew AlignedCollisionObjectArray(&_native->getCollisionObjectArray(), _native);
-	Dispatcher = dispatcher;
-	_broadphase = broadphasePairCache;
+	return _native->m_objects.size();
 }
 
-CollisionWorld::~CollisionWorld()
+CollisionObjectFilterMode CollisionObjectFilter::ObjectFilterMode::get()
 {
-	this->!CollisionWorld();
+	return (CollisionObjectFilterMode)_native->m_objectFilterMode;
+}
+void CollisionObjectFilter::ObjectFilterMode::set(CollisionObjectFilterMode value)
+{
+	_native->m_objectFilterMode = (int)value;
 }
 
-CollisionWorld::!CollisionWorld()
+int CollisionObjectFilter::UserIndex::get()
 {
-	if (this->IsDisposed)
-		return;
+	return _native->m_userIndex;
+}
+void CollisionObjectFilter::UserIndex::set(int value)
+{
+	_native->m_userIndex = value;
+}
 
-#ifndef DISABLE_DEBUGDRAW
-	// Clear IDebugDraw wrapper
-	DebugDrawer = nullptr;
-	if (_dispatchInfo && _dispatchInfo->_debugDrawWrapper) {
-		delete _dispatchInfo->_debugDrawWrapper;
-		_dispatchInfo->_debugDrawWrapper = 0;
-	}
-#endif
-	Dispatcher = nullptr;
+CollisionObjectFilterMode CollisionObjectFilter::UserIndexFilterMode::get()
+{
+	return (CollisionObjectFilterMode)_native->m_userIndexFilterMode;
+}
+void CollisionObjectFilter::UserIndexFilterMode::set(CollisionObjectFilterMode value)
+{
+	_native->m_userIndexFilterMode = (int)value;
+}
 
-#if _DEBUG
-	if (_collisionObjectArray->_native == 0) {
-		// Reference to this world has been lost and
-		// _collisionObjectArray has been arbitrarily finalized by the GC.
-		Console::WriteLine("!" + ToString() + "(): Warning: world is implicitly disposed!");
-	}
-	else if (_collisionObjectArray->Count != 0) {
-		Console::WriteLine(
-			"!" + ToString() + "(): {0} collision objects are still in the world!", _collisionObjectArray->Count);
-	}
 
-	if (_broadphase->IsDisposed) {
-		//throw gcnew ObjectDisposedException("_broadphase",
-		Console::WriteLine(
-			"The BroadphaseInterface was disposed before the CollisionWorld. "
-			"It is required for CollisionWorld cleanup, so dispose it later than the world.");
-	}
-#endif
+NativeRayResultCallback::NativeRayResultCallback(btCollisionWorld::RayResultCallback* native)
+	: RayResultCallback(native)
+{
+}
 
-	if (_broadphase->IsDisposed) {
-		return;
-	}
+NativeRayResultCallback::~NativeRayResultCallback()
+{
+	this->!NativeRayResultCallback();
+}
 
+NativeRayResultCallback::!NativeRayResultCallback()
+{
+	// Presets are allocated with their own aligned operator new
 	delete _native;
 	_native = NULL;
+	_resultFilter = NULL;
 }
 
-void CollisionWorld::AddCollisionObject(CollisionObject^ collisionObject, CollisionFilterGroups collisionFilterGroup,
-	CollisionFilterGroups collisionFilterMask)
+btScalar NativeRayResultCallback::AddSingleResult(LocalRayResult^ rayResult, bool normalInWorldSpace)
 {
-	_collisionObjectArray->Add(collisionObject, (short)collisionFilterGroup, (short)collisionFilterMask);
+	return _native->addSingleResult(*rayResult->_native, normalInWorldSpace);
 }
 
-void CollisionWorld::AddCollisionObject(CollisionObject^ collisionObject, short collisionFilterGroup, short collisionFilterMask)
+bool NativeRayResultCallback::NeedsCollision(BroadphaseProxy^ proxy0)
 {
-	_collisionObjectArray->Add(collisionObject, collisionFilterGroup, collisionFilterMask);
+	return _native->needsCollision(proxy0->_native);
 }
 
-void CollisionWorld::AddCollisionObject(CollisionObject^ collisionObject)
+void NativeRayResultCallback::Reset()
 {
-	_collisionObjectArray->Add(collisionObject);
+	_native->m_closestHitFraction = 1;
+	_native->m_collisionObject = 0;
 }
 
-void CollisionWorld::ComputeOverlappingPairs()
+CollisionObjectFilter^ NativeRayResultCallback::Filter::get()
 {
-	_native->computeOverlappingPairs();
+	return _filter;
+}
+void NativeRayResultCallback::Filter::set(CollisionObjectFilter^ value)
+{
+	_resultFilter->m_filter = GetUnmanagedNullable(value);
+	_filter = value;
 }
 
-void CollisionWorld::ContactPairTest(CollisionObject^ colObjA, CollisionObject^ colObjB,
-	ContactResultCallback^ resultCallback)
+BulletSharp::CollisionObject^ NativeRayResultCallback::IgnoredObject::get()
 {
-	_native->contactPairTest(colObjA->_native, colObjB->_native, *resultCallback->_native);
+	return _ignoredObject;
+}
+void NativeRayResultCallback::IgnoredObject::set(BulletSharp::CollisionObject^ value)
+{
+	_resultFilter->m_ignoredObject = GetUnmanagedNullable(value);
+	_ignoredObject = value;
 }
 
-void CollisionWorld::ContactTest(CollisionObject^ colObj, ContactResultCallback^ resultCallback)
+
+#define Native static_cast<ClosestRayResultCallbackPreset*>(_native)
+
+ClosestRayResultCallbackPreset* NativeClosestRayResultCallback_New(Vector3 rayFromWorld, Vector3 rayToWorld, bool anyHit)
 {
-	_native->contactTest(colObj->_native, *resultCallback->_native);
+	VECTOR3_CONV(rayFromWorld);
+	VECTOR3_CONV(rayToWorld);
+	ClosestRayResultCallbackPreset* native = new ClosestRayResultCallbackPreset(
+		VECTOR3_USE(rayFromWorld), VECTOR3_USE(rayToWorld), anyHit);
+	VECTOR3_DEL(rayFromWorld);
+	VECTOR3_DEL(rayToWorld);
+	return native;
 }
 
-void CollisionWorld::ConvexSweepTest(ConvexShape^ castShape, Matrix from, Matrix to,
-	ConvexResultCallback^ resultCallback, btScalar allowedCcdPenetration)
+NativeClosestRayResultCallback::NativeClosestRayResultCallback(Vector3 rayFromWorld, Vector3 rayToWorld,
+	BulletSharp::CollisionObject^ ignoredObject, bool anyHit)
+	: NativeRayResultCallback(NativeClosestRayResultCallback_New(rayFromWorld, rayToWorld, anyHit))
 {
-	TRANSFORM_CONV(from);
-	TRANSFORM_CONV(to);
-	_native->convexSweepTest((btConvexShape*)castShape->_native, TRANSFORM_USE(from),
-		TRANSFORM_USE(to), *resultCallback->_native, allowedCcdPenetration);
-	TRANSFORM_DEL(from);
-	TRANSFORM_DEL(to);
+	_resultFilter = &Native->m_resultFilter;
+	IgnoredObject = ignoredObject;
 }
 
-void CollisionWorld::ConvexSweepTest(ConvexShape^ castShape, Matrix from, Matrix to,
-	ConvexResultCallback^ resultCallback)
+NativeClosestRayResultCallback::NativeClosestRayResultCallback(Vector3 rayFromWorld, Vector3 rayToWorld)
+	: NativeRayResultCallback(NativeClosestRayResultCallback_New(rayFromWorld, rayToWorld, false))
 {
-	TRANSFORM_CONV(from);
-	TRANSFORM_CONV(to);
-	_native->convexSweepTest((btConvexShape*)castShape->_native, TRANSFORM_USE(from),
-		TRANSFORM_USE(to), *resultCallback->_native);
-	TRANSFORM_DEL(from);
-	TRANSFORM_DEL(to);
+	_resultFilter = &Native->m_resultFilter;
 }
 
-#ifndef DISABLE_DEBUGDRAW
-void CollisionWorld::DebugDrawObject(Matrix worldTransform, CollisionShape^ shape, BtColor color)
+NativeClosestRayResultCallback::NativeClosestRayResultCallback(Vector3 rayFromWorld, Vector3 rayToWorld,
+	BulletSharp::CollisionObject^ ignoredObject)
+	: NativeRayResultCallback(NativeClosestRayResultCallback_New(rayFromWorld, rayToWorld, false))
 {
-	TRANSFORM_CONV(worldTransform);
-	btVector3* colorTemp = BtColorToBtVector(color);
-	_native->debugDrawObject(TRANSFORM_USE(worldTransform), shape->_native, *colorTemp);
-	TRANSFORM_DEL(worldTransform);
-	delete colorTemp;
+	_resultFilter = &Native->m_resultFilter;
+	IgnoredObject = ignoredObject;
 }
 
-void CollisionWorld::DebugDrawWorld()
+Vector3 NativeClosestRayResultCallback::HitNormalWorld::get()
 {
-	_native->debugDrawWorld();
+	return Math::BtVector3ToVector3(&Native->m_hitNormalWorld);
 }
-#endif
 
-void CollisionWorld::ObjectQuerySingle(ConvexShape^ castShape, Matrix rayFromTrans,
-	Matrix rayToTrans, CollisionObject^ collisionObject, CollisionShape^ collisionShape,
-	Matrix colObjWorldTransform, ConvexResultCallback^ resultCallback, btScalar allowedPenetration)
+Vector3 NativeClosestRayResultCallback::HitPointWorld::get()
 {
-	TRANSFORM_CONV(rayFromTrans);
-	TRANSFORM_CONV(rayToTrans);
-	TRANSFORM_CONV(colObjWorldTransform);
-	btCollisionWorld::objectQuerySingle((btConvexShape*)castShape->_native, TRANSFORM_USE(rayFromTrans),
-		TRANSFORM_USE(rayToTrans), collisionObject->_native, collisionShape->_native,
-		TRANSFORM_USE(colObjWorldTransform), *resultCallback->_native, allowedPenetration);
-	TRANSFORM_DEL(rayFromTrans);
-	TRANSFORM_DEL(rayToTrans);
-	TRANSFORM_DEL(colObjWorldTransform);
+	return Math::BtVector3ToVector3(&Native->m_hitPointWorld);
 }
 
-void CollisionWorld::PerformDiscreteCollisionDetection()
+Vector3 NativeClosestRayResultCallback::RayFromWorld::get()
 {
-	_native->performDiscreteCollisionDetection();
+	return Math::BtVector3ToVector3(&Native->m_rayFromWorld);
+}
+void NativeClosestRayResultCallback::RayFromWorld::set(Vector3 value)
+{
+	Math::Vector3ToBtVector3(value, &Native->m_rayFromWorld);
 }
 
-void CollisionWorld::RayTest(Vector3 rayFromWorld, Vector3 rayToWorld, RayResultCallback^ resultCallback)
+Vector3 NativeClosestRayResultCallback::RayToWorld::get()
 {
-	VECTOR3_CONV(rayFromWorld);
-	VECTOR3_CONV(rayToWorld);
-	_native->rayTest(VECTOR3_USE(rayFromWorld), VECTOR3_USE(rayToWorld), *resultCallback->_native);
-	VECTOR3_DEL(rayFromWorld);
-	VECTOR3_DEL(rayToWorld);
+	return Math::BtVector3ToVector3(&Native->m_rayToWorld);
+}
+void NativeClosestRayResultCallback::RayToWorld::set(Vector3 value)
+{
+	Math::Vector3ToBtVector3(value, &Native->m_rayToWorld);
 }
 
-void CollisionWorld::RayTest(Vector3% rayFromWorld, Vector3% rayToWorld, RayResultCallback^ resultCallback)
+
+NativeAnyHitRayResultCallback::NativeAnyHitRayResultCallback(Vector3 rayFromWorld, Vector3 rayToWorld)
+	: NativeClosestRayResultCallback(rayFromWorld, rayToWorld, nullptr, true)
+{
+}
+
+NativeAnyHitRayResultCallback::NativeAnyHitRayResultCallback(Vector3 rayFromWorld, Vector3 rayToWorld,
+	BulletSharp::CollisionObject^ ignoredObject)
+	: NativeClosestRayResultCallback(rayFromWorld, rayToWorld, ignoredObject, true)
+{
+}
+
+
+#undef Native
+#define Native static_cast<AllHitsRayResultCallbackPreset*>(_native)
+
+AllHitsRayResultCallbackPreset* NativeAllHitsRayResultCallback_New(Vector3 rayFromWorld, Vector3 rayToWorld)
 {
 	VECTOR3_CONV(rayFromWorld);
 	VECTOR3_CONV(rayToWorld);
-	_native->rayTest(VECTOR3_USE(rayFromWorld), VECTOR3_USE(rayToWorld), *resultCallback->_native);
+	AllHitsRayResultCallbackPreset* native = new AllHitsRayResultCallbackPreset(
+		VECTOR3_USE(rayFromWorld), VECTOR3_USE(rayToWorld));
 	VECTOR3_DEL(rayFromWorld);
 	VECTOR3_DEL(rayToWorld);
+	return native;
+}
+
+NativeAllHitsRayResultCallback::NativeAllHitsRayResultCallback(Vector3 rayFromWorld, Vector3 rayToWorld)
+	: NativeRayResultCallback(NativeAllHitsRayResultCallback_New(rayFromWorld, rayToWorld))
+{
+	_resultFilter = &Native->m_resultFilter;
+}
+
+void NativeAllHitsRayResultCallback::Reset()
+{
+	NativeRayResultCallback::Reset();
+	Native->m_collisionObjects.resize(0);
+	Native->m_hitFractions.resize(0);
+	Native->m_hitNormalWorld.resize(0);
+	Native->m_hitPointWorld.resize(0);
+}
+
+System::Collections::ObjectModel::ReadOnlyCollection<CollisionObject^>^ NativeAllHitsRayResultCallback::CollisionObjects::get()
+{
+	if (_collisionObjects == nullptr)
+	{
+		// btAlignedObjectArray<const btCollisionObject*> has the same layout as btCollisionObjectArray.
+		// The array is only exposed through a read-only view, so the const objects can't be replaced.
+		_collisionObjects = gcnew System::Collections::ObjectModel::ReadOnlyCollection<CollisionObject^>(
+			gcnew AlignedCollisionObjectArray((btCollisionObjectArray*)&Native->m_collisionObjects));
+	}
+	return _collisionObjects;
+}
+
+AlignedScalarArray^ NativeAllHitsRayResultCallback::HitFractions::get()
+{
+	if (_hitFractions == nullptr)
+	{
+		_hitFractions = gcnew AlignedScalarArray(&Native->m_hitFractions);
+	}
+	return _hitFractions;
+}
+
+AlignedVector3Array^ NativeAllHitsRayResultCallback::HitNormalWorld::get()
+{
+	if (_hitNormalWorld == nullptr)
+	{
+		_hitNormalWorld = gcnew AlignedVector3Array(&Native->m_hitNormalWorld);
+	}
+	return _hitNormalWorld;
+}
+
+AlignedVector3Array^ NativeAllHitsRayResultCallback::HitPointWorld::get()
+{
+	if (_hitPointWorld == nullptr)
+	{
+		_hitPointWorld = gcnew AlignedVector3Array(&Native->m_hitPointWorld);
+	}
+	return _hitPointWorld;
+}
+
+Vector3 NativeAllHitsRayResultCallback::RayFromWorld::get()
+{
+	return Math::BtVector3ToVector3(&Native->m_rayFromWorld);
+}
+void NativeAllHitsRayResultCallback::RayFromWorld::set(Vector3 value)
+{
+	Math::Vector3ToBtVector3(value, &Native->m_rayFromWorld);
+}
+
+Vector3 NativeAllHitsRayResultCallback::RayToWorld::get()
+{
+	return Math::BtVector3ToVector3(&Native->m_rayToWorld);
+}
+void NativeAllHitsRayResultCallback::RayToWorld::set(Vector3 value)
+{
+	Math::Vector3ToBtVector3(value, &Native->m_rayToWorld);
+}
+
+#undef Native
+
+
+NativeConvexResultCallback::NativeConvexResultCallback(btCollisionWorld::ConvexResultCallback* native)
+	: ConvexResultCallback(native)
+{
+}
+
+NativeConvexResultCallback::~NativeConvexResultCallback()
+{
+	this->!NativeConvexResultCallback();
+}
+
+NativeConvexResultCallback::!NativeConvexResultCallback()
+{
+	// Presets are allocated with their own aligned operator new
+	delete _native;
+	_native = NULL;
+	_resultFilter = NULL;
+}
+
+btScalar NativeConvexResultCallback::AddSingleResult(LocalConvexResult^ convexResult, bool normalInWorldSpace)
+{
+	return _native->addSingleResult(*convexResult->_native, normalInWorldSpace);
+}
+
+bool NativeConvexResultCallback::NeedsCollision(BroadphaseProxy^ proxy0)
+{
+	return _native->needsCollision(proxy0->_native);
+}
+
+void NativeConvexResultCallback::Reset()
+{
+	_native->m_closestHitFraction = 1;
+}
+
+CollisionObjectFilter^ NativeConvexResultCallback::Filter::get()
+{
+	return _filter;
+}
+void NativeConvexResultCallback::Filter::set(CollisionObjectFilter^ value)
+{
+	_resultFilter->m_filter = GetUnmanagedNullable(value);
+	_filter = value;
+}
+
+BulletSharp::CollisionObject^ NativeConvexResultCallback::IgnoredObject::get()
+{
+	return _ignoredObject;
+}
+void NativeConvexResultCallback::IgnoredObject::set(BulletSharp::CollisionObject^ value)
+{
+	_resultFilter->m_ignoredObject = GetUnmanagedNullable(value);
+	_ignoredObject = value;
+}
+
+
+#define Native static_cast<ClosestConvexResultCallbackPreset*>(_native)
+
+ClosestConvexResultCallbackPreset* NativeClosestConvexResultCallback_New(Vector3 convexFromWorld,
+	Vector3 convexToWorld, bool anyHit)
+{
+	VECTOR3_CONV(convexFromWorld);
+	VECTOR3_CONV(convexToWorld);
+	ClosestConvexResultCallbackPreset* native = new ClosestConvexResultCallbackPreset(
+		VECTOR3_USE(convexFromWorld), VECTOR3_USE(convexToWorld), anyHit);
+	VECTOR3_DEL(convexFromWorld);
+	VECTOR3_DEL(convexToWorld);
+	return native;
+}
+
+NativeClosestConvexResultCallback::NativeClosestConvexResultCallback(Vector3 convexFromWorld,
+	Vector3 convexToWorld, BulletSharp::CollisionObject^ ignoredObject, bool anyHit)
+	: NativeConvexResultCallback(NativeClosestConvexResultCallback_New(convexFromWorld, convexToWorld, anyHit))
+{
+	_resultFilter = &Native->m_resultFilter;
+	IgnoredObject = ignoredObject;
+}
+
+NativeClosestConvexResultCallback::NativeClosestConvexResultCallback(Vector3 convexFromWorld,
+	Vector3 convexToWorld)
+	: NativeConvexResultCallback(NativeClosestConvexResultCallback_New(convexFromWorld, convexToWorld, false))
+{
+	_resultFilter = &Native->m_resultFilter;
+}
+
+NativeClosestConvexResultCallback::NativeClosestConvexResultCallback(Vector3 convexFromWorld,
+	Vector3 convexToWorld, BulletSharp::CollisionObject^ ignoredObject)
+	: NativeConvexResultCallback(NativeClosestConvexResultCallback_New(convexFromWorld, convexToWorld, false))
+{
+	_resultFilter = &Native->m_resultFilter;
+	IgnoredObject = ignoredObject;
+}
+
+void NativeClosestConvexResultCallback::Reset()
+{
+	NativeConvexResultCallback::Reset();
+	Native->m_hitCollisionObject = 0;
+}
+
+Vector3 NativeClosestConvexResultCallback::ConvexFromWorld::get()
+{
+	return Math::BtVector3ToVector3(&Native->m_convexFromWorld);
+}
+void NativeClosestConvexResultCallback::ConvexFromWorld::set(Vector3 value)
+{
+	Math::Vector3ToBtVector3(value, &Native->m_convexFromWorld);
+}
+
+Vector3 NativeClosestConvexResultCallback::ConvexToWorld::get()
+{
+	return Math::BtVector3ToVector3(&Native->m_convexToWorld);
+}
+void NativeClosestConvexResultCallback::ConvexToWorld::set(Vector3 value)
+{
+	Math::Vector3ToBtVector3(value, &Native->m_convexToWorld);
+}
+
+BulletSharp::CollisionObject^ NativeClosestConvexResultCallback::HitCollisionObject::get()
+{
+	return BulletSharp::CollisionObject::GetManaged((btCollisionObject*)Native->m_hitCollisionObject);
+}
+
+Vector3 NativeClosestConvexResultCallback::HitNormalWorld::get()
+{
+	return Math::BtVector3ToVector3(&Native->m_hitNormalWorld);
+}
+
+Vector3 NativeClosestConvexResultCallback::HitPointWorld::get()
+{
+	return Math::BtVector3ToVector3(&Native->m_hitPointWorld);
+}
+
+
+NativeAnyHitConvexResultCallback::NativeAnyHitConvexResultCallback(Vector3 convexFromWorld,
+	Vector3 convexToWorld)
+	: NativeClosestConvexResultCallback(convexFromWorld, convexToWorld, nullptr, true)
+{
+}
+
+NativeAnyHitConvexResultCallback::NativeAnyHitConvexResultCallback(Vector3 convexFromWorld,
+	Vector3 convexToWorld, BulletSharp::CollisionObject^ ignoredObject)
+	: NativeClosestConvexResultCallback(convexFromWorld, convexToWorld, ignoredObject, true)
+{
+}
+
+#undef Native
+
+
+ContactResultCallback::~ContactResultCallback()
+{
+	this->!ContactResultCallback();
+}
+
+ContactResultCallback::!ContactResultCallback()
+{
+	if (this->IsDisposed)
+		return;
+	
+	delete _native;
+	_native = NULL;
+}
+
+ContactResultCallback::ContactResultCallback()
+{
+	_native = new ContactResultCallbackWrapper(this);
+}
+
+bool ContactResultCallback::NeedsCollision(BroadphaseProxy^ proxy0)
+{
+	bool collides = (proxy0->CollisionFilterGroup & CollisionFilterMask) != CollisionFilterGroups::None;
+	collides = collides && (CollisionFilterGroup & proxy0->CollisionFilterMask) != CollisionFilterGroups::None;
+	return collides;
+}
+
+CollisionFilterGroups ContactResultCallback::CollisionFilterGroup::get()
+{
+	return (CollisionFilterGroups)_native->m_collisionFilterGroup;
+}
+void ContactResultCallback::CollisionFilterGroup::set(CollisionFilterGroups value)
+{
+	_native->m_collisionFilterGroup = (short int)value;
+}
+
+CollisionFilterGroups ContactResultCallback::CollisionFilterMask::get()
+{
+	return (CollisionFilterGroups)_native->m_collisionFilterMask;
+}
+void ContactResultCallback::CollisionFilterMask::set(CollisionFilterGroups value)
+{
+	_native->m_collisionFilterMask = (short int)value;
+}
+
+bool ContactResultCallback::IsDisposed::get()
+{
+	return (_native == NULL);
+}
+
+
+#undef Callback
+#define Callback static_cast<BulletSharp::ContactResultCallback^>(VoidPtrToGCHandle(_callback).Target)
+
+ContactResultCallbackWrapper::ContactResultCallbackWrapper(BulletSharp::ContactResultCallback^ callback)
+{
+	_callback = GCHandleToVoidPtr(GCHandle::Alloc(callback, GCHandleType::Weak));
+}
+
+ContactResultCallbackWrapper::~ContactResultCallbackWrapper()
+{
+	VoidPtrToGCHandle(_callback).Free();
+}
+
+bool ContactResultCallbackWrapper::needsCollision(btBroadphaseProxy* proxy0) const
+{
+	return Callback->NeedsCollision(BroadphaseProxy::GetManaged(proxy0));
+}
+
+btScalar ContactResultCallbackWrapper::addSingleResult(btManifoldPoint& cp,
+	const btCollisionObjectWrapper* colObj0Wrap, int partId0, int index0,
+	const btCollisionObjectWrapper* colObj1Wrap, int partId1, int index1)
+{
+	return Callback->AddSingleResult(gcnew ManifoldPoint(&cp, true),
+		gcnew CollisionObjectWrapper((btCollisionObjectWrapper*)colObj0Wrap), partId0, index0,
+		gcnew CollisionObjectWrapper((btCollisionObjectWrapper*)colObj1Wrap), partId1, index1);
+}
+
+
+#pragma managed(push, off)
+ATTRIBUTE_ALIGNED16(struct) BatchQueryHit
+{
+	BT_DECLARE_ALIGNED_ALLOCATOR();
+
+	btVector3 m_hitPointWorld;
+	btVector3 m_hitNormalWorld;
+	const btCollisionObject* m_collisionObject;
+	btScalar m_hitFraction;
+};
+
+class BatchQueryBuffers
+{
+public:
+	btAlignedObjectArray<BatchQueryHit> m_hits;
+	btAlignedObjectArray<btVector3> m_rayFromWorld;
+	btAlignedObjectArray<btVector3> m_rayToWorld;
+	btAlignedObjectArray<btTransform> m_from;
+	btAlignedObjectArray<btTransform> m_to;
+	btAlignedObjectArray<btConvexShape*> m_castShapes;
+};
+
+// Inserts a hit into a list of at most maxHits hits sorted by hit fraction.
+// Returns the fraction beyond which further hits are discarded.
+btScalar BatchQuery_InsertHit(BatchQueryHit* hits, int* numHits, int maxHits, const BatchQueryHit& hit)
+{
+	int slot = *numHits;
+	while (slot > 0 && hits[slot - 1].m_hitFraction > hit.m_hitFraction)
+	{
+		slot--;
+	}
+	if (slot < maxHits)
+	{
+		int last = (*numHits < maxHits) ? *numHits : maxHits - 1;
+		for (int i = last; i > slot; i--)
+		{
+			hits[i] = hits[i - 1];
+		}
+		hits[slot] = hit;
+		if (*numHits < maxHits)
+		{
+			(*numHits)++;
+		}
+	}
+	return (*numHits == maxHits) ? hits[maxHits - 1].m_hitFraction : btScalar(1);
+}
+#pragma managed(pop)
+
+BatchQueryResults::~BatchQueryResults()
+{
+	this->!BatchQueryResults();
+}
+
+BatchQueryResults::!BatchQueryResults()
+{
+	delete _buffers;
+	_buffers = NULL;
+}
+
+BatchQueryResults::BatchQueryResults()
+{
+	_maxHitsPerQuery = 1;
+	_buffers = new BatchQueryBuffers();
+	Reserve(0);
+}
+
+BatchQueryResults::BatchQueryResults(int maxHitsPerQuery)
+{
+	if (maxHitsPerQuery < 1)
+		throw gcnew ArgumentOutOfRangeException("maxHitsPerQuery");
+	_maxHitsPerQuery = maxHitsPerQuery;
+	_buffers = new BatchQueryBuffers();
+	Reserve(0);
+}
+
+BatchQueryResults::BatchQueryResults(int maxHitsPerQuery, int queryCapacity)
+{
+	if (maxHitsPerQuery < 1)
+		throw gcnew ArgumentOutOfRangeException("maxHitsPerQuery");
+	_maxHitsPerQuery = maxHitsPerQuery;
+	_buffers = new BatchQueryBuffers();
+	Reserve(queryCapacity);
+}
+
+void BatchQueryResults::Reserve(int numQueries)
+{
+	if (_hitCounts == nullptr || _hitCounts->Length < numQueries)
+	{
+		int capacity = (_hitCounts != nullptr) ? btMax(numQueries, _hitCounts->Length * 2) : numQueries;
+		int hitCapacity = capacity * _maxHitsPerQuery;
+		_hitCounts = gcnew array<int>(capacity);
+		_collisionObjectHandles = gcnew array<int>(hitCapacity);
+		_collisionObjectIndices = gcnew array<int>(hitCapacity);
+		_collisionObjects = gcnew array<BulletSharp::CollisionObject^>(hitCapacity);
+		_hitFractions = gcnew array<btScalar>(hitCapacity);
+		_hitNormalsWorld = gcnew array<Vector3>(hitCapacity);
+		_hitPointsWorld = gcnew array<Vector3>(hitCapacity);
+		_buffers->m_hits.resizeNoInitialize(hitCapacity);
+	}
+}
+
+array<int>^ BatchQueryResults::CollisionObjectHandles::get()
+{
+	return _collisionObjectHandles;
+}
+
+array<int>^ BatchQueryResults::CollisionObjectIndices::get()
+{
+	return _collisionObjectIndices;
+}
+
+array<CollisionObject^>^ BatchQueryResults::CollisionObjects::get()
+{
+	if (!_collisionObjectsResolved)
+	{
+		for (int i = 0; i < _numQueries; i++)
+		{
+			int offset = i * _maxHitsPerQuery;
+			int numHits = _hitCounts[i];
+			for (int j = 0; j < numHits; j++)
+			{
+				int handle = _collisionObjectHandles[offset + j];
+				if (handle != 0)
+				{
+					_collisionObjects[offset + j] = _objectTable->GetByHandleInternal(handle);
+				}
+			}
+		}
+		_collisionObjectsResolved = true;
+	}
+	return _collisionObjects;
+}
+
+array<int>^ BatchQueryResults::HitCounts::get()
+{
+	return _hitCounts;
+}
+
+array<btScalar>^ BatchQueryResults::HitFractions::get()
+{
+	return _hitFractions;
+}
+
+array<Vector3>^ BatchQueryResults::HitNormalsWorld::get()
+{
+	return _hitNormalsWorld;
+}
+
+array<Vector3>^ BatchQueryResults::HitPointsWorld::get()
+{
+	return _hitPointsWorld;
+}
+
+int BatchQueryResults::MaxHitsPerQuery::get()
+{
+	return _maxHitsPerQuery;
+}
+
+int BatchQueryResults::NumQueries::get()
+{
+	return _numQueries;
+}
+
+void BatchQueryResults_CopyHits(BatchQueryResults^ results, const BatchQueryHit* hits, int numQueries,
+	AlignedCollisionObjectArray^ objectTable)
+{
+	array<int>^ collisionObjectHandles = results->_collisionObjectHandles;
+	array<int>^ collisionObjectIndices = results->_collisionObjectIndices;
+	array<BulletSharp::CollisionObject^>^ collisionObjects = results->_collisionObjects;
+	array<int>^ hitCounts = results->_hitCounts;
+	array<btScalar>^ hitFractions = results->_hitFractions;
+	array<Vector3>^ hitNormalsWorld = results->_hitNormalsWorld;
+	array<Vector3>^ hitPointsWorld = results->_hitPointsWorld;
+	int maxHits = results->_maxHitsPerQuery;
+
+	for (int i = 0; i < numQueries; i++)
+	{
+		int numHits = hitCounts[i];
+		int offset = i * maxHits;
+		for (int j = 0; j < maxHits; j++)
+		{
+			int index = offset + j;
+			if (j < numHits)
+			{
+				const BatchQueryHit* hit = &hits[index];
+				btCollisionObject* collisionObject = (btCollisionObject*)hit->m_collisionObject;
+				int handle = objectTable->GetHandle(collisionObject);
+				collisionObjectHandles[index] = handle;
+				collisionObjectIndices[index] = collisionObject->getWorldArrayIndex();
+				// Objects with handles are resolved when CollisionObjects is read
+				collisionObjects[index] = (handle != 0) ? nullptr : BulletSharp::CollisionObject::GetManaged(collisionObject);
+				hitFractions[index] = hit->m_hitFraction;
+				Math::BtVector3ToVector3(&hit->m_hitNormalWorld, hitNormalsWorld[index]);
+				Math::BtVector3ToVector3(&hit->m_hitPointWorld, hitPointsWorld[index]);
+			}
+			else
+			{
+				// Don't keep removed objects alive
+				collisionObjectHandles[index] = 0;
+				collisionObjectIndices[index] = -1;
+				collisionObjects[index] = nullptr;
+			}
+		}
+	}
+	results->_numQueries = numQueries;
+	results->_objectTable = objectTable;
+	results->_collisionObjectsResolved = false;
+}
+
+void BatchQuery_CheckFilterArrays(array<CollisionFilterGroups>^ collisionFilterGroups,
+	array<CollisionFilterGroups>^ collisionFilterMasks, int numQueries)
+{
+	if (collisionFilterGroups != nullptr && collisionFilterGroups->Length < numQueries)
+		throw gcnew ArgumentException("Array too small.", "collisionFilterGroups");
+	if (collisionFilterMasks != nullptr && collisionFilterMasks->Length < numQueries)
+		throw gcnew ArgumentException("Array too small.", "collisionFilterMasks");
+}
+
+
+CollisionWorld::CollisionWorld(btCollisionWorld* native)
+{
+	if (!native) {
+		return;
+	}
+	_native = native;
+	_collisionObjectArray = gcnew AlignedCollisionObjectArray(&_native->getCollisionObjectArray(), native);
+}
+
+CollisionWorld::CollisionWorld(BulletSharp::Dispatcher^ dispatcher, BroadphaseInterface^ broadphasePairCache,
+	BulletSharp::CollisionConfiguration^ collisionConfiguration)
+{
+	_native = new btCollisionWorld(dispatcher->_native, broadphasePairCache->_native,
+		collisionConfiguration->_native);
+	_collisionObjectArray = gcnew AlignedCollisionObjectArray(&_native->getCollisionObjectArray(), _native);
+	Dispatcher = dispatcher;
+	_broadphase = broadphasePairCache;
+}
+
+CollisionWorld::~CollisionWorld()
+{
+	this->!CollisionWorld();
+}
+
+CollisionWorld::!CollisionWorld()
+{
+	if (this->IsDisposed)
+		return;
+
+#ifndef DISABLE_DEBUGDRAW
+	// Clear IDebugDraw wrapper
+	DebugDrawer = nullptr;
+	if (_dispatchInfo && _dispatchInfo->_debugDrawWrapper) {
+		delete _dispatchInfo->_debugDrawWrapper;
+		_dispatchInfo->_debugDrawWrapper = 0;
+	}
+#endif
+	Dispatcher = nullptr;
+
+#if _DEBUG
+	if (_collisionObjectArray->_native == 0) {
+		// Reference to this world has been lost and
+		// _collisionObjectArray has been arbitrarily finalized by the GC.
+		Console::WriteLine("!" + ToString() + "(): Warning: world is implicitly disposed!");
+	}
+	else if (_collisionObjectArray->Count != 0) {
+		Console::WriteLine(
+			"!" + ToString() + "(): {0} collision objects are still in the world!", _collisionObjectArray->Count);
+	}
+
+	if (_broadphase->IsDisposed) {
+		//throw gcnew ObjectDisposedException("_broadphase",
+		Console::WriteLine(
+			"The BroadphaseInterface was disposed before the CollisionWorld. "
+			"It is required for CollisionWorld cleanup, so dispose it later than the world.");
+	}
+#endif
+
+	if (_broadphase->IsDisposed) {
+		return;
+	}
+
+	delete _native;
+	_native = NULL;
+}
+
+void CollisionWorld::AddCollisionObject(CollisionObject^ collisionObject, CollisionFilterGroups collisionFilterGroup,
+	CollisionFilterGroups collisionFilterMask)
+{
+	_collisionObjectArray->Add(collisionObject, (short)collisionFilterGroup, (short)collisionFilterMask);
+}
+
+void CollisionWorld::AddCollisionObject(CollisionObject^ collisionObject, short collisionFilterGroup, short collisionFilterMask)
+{
+	_collisionObjectArray->Add(collisionObject, collisionFilterGroup, collisionFilterMask);
+}
+
+void CollisionWorld::AddCollisionObject(CollisionObject^ collisionObject)
+{
+	_collisionObjectArray->Add(collisionObject);
+}
+
+void CollisionWorld::ComputeOverlappingPairs()
+{
+	_native->computeOverlappingPairs();
+}
+
+void CollisionWorld::ContactPairTest(CollisionObject^ colObjA, CollisionObject^ colObjB,
+	ContactResultCallback^ resultCallback)
+{
+	_native->contactPairTest(colObjA->_native, colObjB->_native, *resultCallback->_native);
+}
+
+void CollisionWorld::ContactTest(CollisionObject^ colObj, ContactResultCallback^ resultCallback)
+{
+	_native->contactTest(colObj->_native, *resultCallback->_native);
+}
+
+void CollisionWorld::ConvexSweepTest(ConvexShape^ castShape, Matrix from, Matrix to,
+	ConvexResultCallback^ resultCallback, btScalar allowedCcdPenetration)
+{
+	TRANSFORM_CONV(from);
+	TRANSFORM_CONV(to);
+	_native->convexSweepTest((btConvexShape*)castShape->_native, TRANSFORM_USE(from),
+		TRANSFORM_USE(to), *resultCallback->_native, allowedCcdPenetration);
+	TRANSFORM_DEL(from);
+	TRANSFORM_DEL(to);
+}
+
+void CollisionWorld::ConvexSweepTest(ConvexShape^ castShape, Matrix from, Matrix to,
+	ConvexResultCallback^ resultCallback)
+{
+	TRANSFORM_CONV(from);
+	TRANSFORM_CONV(to);
+	_native->convexSweepTest((btConvexShape*)castShape->_native, TRANSFORM_USE(from),
+		TRANSFORM_USE(to), *resultCallback->_native);
+	TRANSFORM_DEL(from);
+	TRANSFORM_DEL(to);
+}
+
+#pragma managed(push, off)
+// Keeps the closest m_maxHits hits of one convex sweep
+class BatchConvexResultCallback : public btCollisionWorld::ConvexResultCallback
+{
+public:
+	BatchQueryHit* m_hits;
+	int m_maxHits;
+	int m_numHits;
+
+	void reset(short int collisionFilterGroup, short int collisionFilterMask, BatchQueryHit* hits)
+	{
+		m_collisionFilterGroup = collisionFilterGroup;
+		m_collisionFilterMask = collisionFilterMask;
+		m_closestHitFraction = btScalar(1);
+		m_hits = hits;
+		m_numHits = 0;
+	}
+
+	virtual btScalar addSingleResult(btCollisionWorld::LocalConvexResult& convexResult, bool normalInWorldSpace)
+	{
+		BatchQueryHit hit;
+		ClosestConvexResultCallback_AddSingleResult(&convexResult, normalInWorldSpace, &hit.m_hitNormalWorld);
+		hit.m_hitPointWorld = convexResult.m_hitPointLocal;
+		hit.m_collisionObject = convexResult.m_hitCollisionObject;
+		hit.m_hitFraction = convexResult.m_hitFraction;
+		m_closestHitFraction = BatchQuery_InsertHit(m_hits, &m_numHits, m_maxHits, hit);
+		return m_closestHitFraction;
+	}
+};
+
+// Like btDbvt::rayTest, btDbvt::collideTV keeps its traversal stack local,
+// so worker threads can query the swept volumes concurrently
+struct BatchSweepDbvtCollider : btDbvt::ICollide
+{
+	btTransform m_convexFromTrans;
+	btTransform m_convexToTrans;
+	const btConvexShape* m_castShape;
+	btScalar m_allowedCcdPenetration;
+	btCollisionWorld::ConvexResultCallback* m_resultCallback;
+
+	void Process(const btDbvtNode* leaf)
+	{
+		btBroadphaseProxy* proxy = (btBroadphaseProxy*)leaf->data;
+		btCollisionObject* collisionObject = (btCollisionObject*)proxy->m_clientObject;
+		if (m_resultCallback->needsCollision(collisionObject->getBroadphaseHandle()))
+		{
+			btCollisionWorld::objectQuerySingle(m_castShape, m_convexFromTrans, m_convexToTrans,
+				collisionObject, collisionObject->getCollisionShape(), collisionObject->getWorldTransform(),
+				*m_resultCallback, m_allowedCcdPenetration);
+		}
+	}
+};
+
+void CollisionWorld_ConvexSweepTestBatch(const btCollisionWorld* world, const btDbvtBroadphase* dbvtBroadphase,
+	btConvexShape* const* castShapes, int numCastShapes, const btTransform* from, const btTransform* to,
+	const int* collisionFilterGroups, const int* collisionFilterMasks, btScalar allowedCcdPenetration,
+	int start, int end, BatchQueryHit* hits, int maxHits, int* hitCounts)
+{
+	BatchConvexResultCallback resultCallback;
+	resultCallback.m_maxHits = maxHits;
+
+	BatchSweepDbvtCollider collider;
+	collider.m_allowedCcdPenetration = allowedCcdPenetration;
+	collider.m_resultCallback = &resultCallback;
+
+	for (int i = start; i < end; i++)
+	{
+		const btConvexShape* castShape = castShapes[(numCastShapes == 1) ? 0 : i];
+		short int group = collisionFilterGroups ?
+			(short int)collisionFilterGroups[i] : (short int)btBroadphaseProxy::DefaultFilter;
+		short int mask = collisionFilterMasks ?
+			(short int)collisionFilterMasks[i] : (short int)btBroadphaseProxy::AllFilter;
+		resultCallback.reset(group, mask, &hits[i * maxHits]);
+
+		if (dbvtBroadphase)
+		{
+			// Bounds of the shape over the whole sweep, including rotation
+			btVector3 linVel, angVel, aabbMin, aabbMax;
+			btTransformUtil::calculateVelocity(from[i], to[i], btScalar(1), linVel, angVel);
+			castShape->calculateTemporalAabb(from[i], linVel, angVel, btScalar(1), aabbMin, aabbMax);
+			btDbvtVolume volume = btDbvtVolume::FromMM(aabbMin, aabbMax);
+
+			collider.m_convexFromTrans = from[i];
+			collider.m_convexToTrans = to[i];
+			collider.m_castShape = castShape;
+			dbvtBroadphase->m_sets[0].collideTV(dbvtBroadphase->m_sets[0].m_root, volume, collider);
+			dbvtBroadphase->m_sets[1].collideTV(dbvtBroadphase->m_sets[1].m_root, volume, collider);
+		}
+		else
+		{
+			world->convexSweepTest(castShape, from[i], to[i], resultCallback, allowedCcdPenetration);
+		}
+		hitCounts[i] = resultCallback.m_numHits;
+	}
+}
+#pragma managed(pop)
+
+ref class ConvexSweepTestBatchJob
+{
+internal:
+	const btCollisionWorld* _world;
+	const btDbvtBroadphase* _dbvtBroadphase;
+	btConvexShape** _castShapes;
+	int _numCastShapes;
+	const btTransform* _from;
+	const btTransform* _to;
+	const int* _collisionFilterGroups;
+	const int* _collisionFilterMasks;
+	btScalar _allowedCcdPenetration;
+	BatchQueryHit* _hits;
+	int* _hitCounts;
+	int _maxHits;
+	int _numSweeps;
+	int _sweepsPerJob;
+
+	void Run(int job)
+	{
+		int start = job * _sweepsPerJob;
+		int end = btMin(start + _sweepsPerJob, _numSweeps);
+		CollisionWorld_ConvexSweepTestBatch(_world, _dbvtBroadphase, _castShapes, _numCastShapes, _from, _to,
+			_collisionFilterGroups, _collisionFilterMasks, _allowedCcdPenetration,
+			start, end, _hits, _maxHits, _hitCounts);
+	}
+};
+
+void CollisionWorld::ConvexSweepTestBatch(array<ConvexShape^>^ castShapes, array<Matrix>^ from, array<Matrix>^ to,
+	array<CollisionFilterGroups>^ collisionFilterGroups, array<CollisionFilterGroups>^ collisionFilterMasks,
+	BatchQueryResults^ results, btScalar allowedCcdPenetration, int numThreads)
+{
+	if (castShapes == nullptr)
+		throw gcnew ArgumentNullException("castShapes");
+	if (from == nullptr)
+		throw gcnew ArgumentNullException("from");
+	if (to == nullptr)
+		throw gcnew ArgumentNullException("to");
+	if (results == nullptr)
+		throw gcnew ArgumentNullException("results");
+
+	int numSweeps = from->Length;
+	if (to->Length != numSweeps)
+		throw gcnew ArgumentException("Array lengths do not match.", "to");
+	// One shape for all sweeps or one shape per sweep
+	int numCastShapes = castShapes->Length;
+	if (numCastShapes != 1 && numCastShapes != numSweeps)
+		throw gcnew ArgumentException("Array lengths do not match.", "castShapes");
+	BatchQuery_CheckFilterArrays(collisionFilterGroups, collisionFilterMasks, numSweeps);
+
+	results->Reserve(numSweeps);
+	results->_numQueries = 0;
+	if (numSweeps == 0)
+		return;
+
+	BatchQueryBuffers* buffers = results->_buffers;
+	buffers->m_castShapes.resizeNoInitialize(numCastShapes);
+	for (int i = 0; i < numCastShapes; i++)
+	{
+		if (castShapes[i] == nullptr)
+			throw gcnew ArgumentNullException("castShapes");
+		buffers->m_castShapes[i] = (btConvexShape*)castShapes[i]->_native;
+	}
+	btConvexShape** castShapesTemp = &buffers->m_castShapes[0];
+
+	buffers->m_from.resizeNoInitialize(numSweeps);
+	buffers->m_to.resizeNoInitialize(numSweeps);
+	for (int i = 0; i < numSweeps; i++)
+	{
+		Math::MatrixToBtTransform(from[i], &buffers->m_from[i]);
+		Math::MatrixToBtTransform(to[i], &buffers->m_to[i]);
+	}
+	btTransform* fromTemp = &buffers->m_from[0];
+	btTransform* toTemp = &buffers->m_to[0];
+
+	int maxHits = results->_maxHitsPerQuery;
+	BatchQueryHit* hits = &buffers->m_hits[0];
+
+	pin_ptr<CollisionFilterGroups> collisionFilterGroupsPtr;
+	if (collisionFilterGroups != nullptr)
+		collisionFilterGroupsPtr = &collisionFilterGroups[0];
+	pin_ptr<CollisionFilterGroups> collisionFilterMasksPtr;
+	if (collisionFilterMasks != nullptr)
+		collisionFilterMasksPtr = &collisionFilterMasks[0];
+	pin_ptr<int> hitCountsPtr = &results->_hitCounts[0];
+
+	// Worker threads need a broadphase that can be traversed concurrently
+	btDbvtBroadphase* dbvtBroadphase = (numThreads > 1) ? dynamic_cast<btDbvtBroadphase*>(_native->getBroadphase()) : 0;
+	if (dbvtBroadphase)
+	{
+		int numJobs = btMin(numThreads, numSweeps);
+		ConvexSweepTestBatchJob^ job = gcnew ConvexSweepTestBatchJob();
+		job->_world = _native;
+		job->_dbvtBroadphase = dbvtBroadphase;
+		job->_castShapes = castShapesTemp;
+		job->_numCastShapes = numCastShapes;
+		job->_from = fromTemp;
+		job->_to = toTemp;
+		job->_collisionFilterGroups = (int*)(CollisionFilterGroups*)collisionFilterGroupsPtr;
+		job->_collisionFilterMasks = (int*)(CollisionFilterGroups*)collisionFilterMasksPtr;
+		job->_allowedCcdPenetration = allowedCcdPenetration;
+		job->_hits = hits;
+		job->_hitCounts = hitCountsPtr;
+		job->_maxHits = maxHits;
+		job->_numSweeps = numSweeps;
+		job->_sweepsPerJob = (numSweeps + numJobs - 1) / numJobs;
+		System::Threading::Tasks::Parallel::For(0, numJobs, gcnew Action<int>(job, &ConvexSweepTestBatchJob::Run));
+	}
+	else
+	{
+		CollisionWorld_ConvexSweepTestBatch(_native, 0, castShapesTemp, numCastShapes, fromTemp, toTemp,
+			(int*)(CollisionFilterGroups*)collisionFilterGroupsPtr, (int*)(CollisionFilterGroups*)collisionFilterMasksPtr,
+			allowedCcdPenetration, 0, numSweeps, hits, maxHits, hitCountsPtr);
+	}
+
+	BatchQueryResults_CopyHits(results, hits, numSweeps, _collisionObjectArray);
+}
+
+void CollisionWorld::ConvexSweepTestBatch(array<ConvexShape^>^ castShapes, array<Matrix>^ from, array<Matrix>^ to,
+	array<CollisionFilterGroups>^ collisionFilterGroups, array<CollisionFilterGroups>^ collisionFilterMasks,
+	BatchQueryResults^ results)
+{
+	ConvexSweepTestBatch(castShapes, from, to, collisionFilterGroups, collisionFilterMasks, results, 0, 1);
+}
+
+void CollisionWorld::ConvexSweepTestBatch(array<ConvexShape^>^ castShapes, array<Matrix>^ from, array<Matrix>^ to,
+	BatchQueryResults^ results)
+{
+	ConvexSweepTestBatch(castShapes, from, to, nullptr, nullptr, results, 0, 1);
+}
+
+void CollisionWorld::ConvexSweepTestBatch(ConvexShape^ castShape, array<Matrix>^ from, array<Matrix>^ to,
+	BatchQueryResults^ results)
+{
+	ConvexSweepTestBatch(gcnew array<ConvexShape^> { castShape }, from, to, nullptr, nullptr, results, 0, 1);
+}
+
+CollisionObject^ CollisionWorld::GetCollisionObject(int handle)
+{
+	return _collisionObjectArray->GetByHandle(handle);
+}
+
+#ifndef DISABLE_DEBUGDRAW
+void CollisionWorld::DebugDrawObject(Matrix worldTransform, CollisionShape^ shape, BtColor color)
+{
+	TRANSFORM_CONV(worldTransform);
+	btVector3* colorTemp = BtColorToBtVector(color);
+	_native->debugDrawObject(TRANSFORM_USE(worldTransform), shape->_native, *colorTemp);
+	TRANSFORM_DEL(worldTransform);
+	delete colorTemp;
+}
+
+void CollisionWorld::DebugDrawWorld()
+{
+	_native->debugDrawWorld();
+}
+
+#pragma managed(push, off)
+struct DebugDrawDbvtCollector : btDbvt::ICollide
+{
+	btAlignedObjectArray<char>* m_visible;
+
+	void Process(const btDbvtNode* leaf)
+	{
+		btCollisionObject* colObj = (btCollisionObject*)((btDbvtProxy*)leaf->data)->m_clientObject;
+		(*m_visible)[colObj->getWorldArrayIndex()] = 1;
+	}
+};
+
+struct DebugDrawAabbCollector : btBroadphaseAabbCallback
+{
+	btAlignedObjectArray<char>* m_visible;
+
+	virtual bool process(const btBroadphaseProxy* proxy)
+	{
+		btCollisionObject* colObj = (btCollisionObject*)proxy->m_clientObject;
+		(*m_visible)[colObj->getWorldArrayIndex()] = 1;
+		return true;
+	}
+};
+
+bool DebugDraw_IsAabbOutside(const btVector3& aabbMin, const btVector3& aabbMax,
+	const btVector3* normals, const btScalar* offsets, int numPlanes)
+{
+	for (int i = 0; i < numPlanes; i++)
+	{
+		const btVector3& n = normals[i];
+		btVector3 corner(
+			n.getX() >= 0 ? aabbMax.getX() : aabbMin.getX(),
+			n.getY() >= 0 ? aabbMax.getY() : aabbMin.getY(),
+			n.getZ() >= 0 ? aabbMax.getZ() : aabbMin.getZ());
+		if (n.dot(corner) + offsets[i] < 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// Same as btCollisionWorld::debugDrawWorld and btDiscreteDynamicsWorld::debugDrawWorld,
+// but only for objects whose broadphase AABB overlaps the frustum planes or the region.
+void CollisionWorld_DebugDrawWorld(btCollisionWorld* world, const btScalar* planes, int numPlanes,
+	const btVector3* regionMin, const btVector3* regionMax, const btVector3* lodCenter, btScalar lodDistance)
+{
+	btIDebugDraw* debugDrawer = world->getDebugDrawer();
+	if (!debugDrawer)
+	{
+		return;
+	}
+	int debugMode = debugDrawer->getDebugMode();
+
+	btVector3 normals[6];
+	btScalar offsets[6];
+	for (int i = 0; i < numPlanes; i++)
+	{
+		normals[i].setValue(planes[i*4], planes[i*4+1], planes[i*4+2]);
+		offsets[i] = planes[i*4+3];
+	}
+
+	int numObjects = world->getNumCollisionObjects();
+	btAlignedObjectArray<char> visible;
+	visible.resize(numObjects, 0);
+
+	btBroadphaseInterface* broadphase = world->getBroadphase();
+	if (regionMin)
+	{
+		DebugDrawAabbCollector collector;
+		collector.m_visible = &visible;
+		broadphase->aabbTest(*regionMin, *regionMax, collector);
+	}
+	else
+	{
+		btDbvtBroadphase* dbvtBroadphase = dynamic_cast<btDbvtBroadphase*>(broadphase);
+		if (dbvtBroadphase)
+		{
+			DebugDrawDbvtCollector collector;
+			collector.m_visible = &visible;
+			btDbvt::collideKDOP(dbvtBroadphase->m_sets[0].m_root, normals, offsets, numPlanes, collector);
+			btDbvt::collideKDOP(dbvtBroadphase->m_sets[1].m_root, normals, offsets, numPlanes, collector);
+		}
+		else
+		{
+			btCollisionObjectArray& objects = world->getCollisionObjectArray();
+			for (int i = 0; i < numObjects; i++)
+			{
+				btBroadphaseProxy* proxy = objects[i]->getBroadphaseHandle();
+				if (proxy && !DebugDraw_IsAabbOutside(proxy->m_aabbMin, proxy->m_aabbMax, normals, offsets, numPlanes))
+				{
+					visible[i] = 1;
+				}
+			}
+		}
+	}
+
+	if (debugMode & btIDebugDraw::DBG_DrawContactPoints)
+	{
+		btDispatcher* dispatcher = world->getDispatcher();
+		int numManifolds = dispatcher->getNumManifolds();
+		btVector3 color(1, 1, 0);
+		for (int i = 0; i < numManifolds; i++)
+		{
+			btPersistentManifold* manifold = dispatcher->getManifoldByIndexInternal(i);
+			int indexA = manifold->getBody0()->getWorldArrayIndex();
+			int indexB = manifold->getBody1()->getWorldArrayIndex();
+			if (!visible[indexA] && !visible[indexB])
+			{
+				continue;
+			}
+			int numContacts = manifold->getNumContacts();
+			for (int j = 0; j < numContacts; j++)
+			{
+				btManifoldPoint& cp = manifold->getContactPoint(j);
+				debugDrawer->drawContactPoint(cp.m_positionWorldOnB, cp.m_normalWorldOnB, cp.getDistance(), cp.getLifeTime(), color);
+			}
+		}
+	}
+
+	if (debugMode & (btIDebugDraw::DBG_DrawWireframe | btIDebugDraw::DBG_DrawAabb))
+	{
+#ifndef DISABLE_SOFTBODY
+		btSoftRigidDynamicsWorld* softWorld = dynamic_cast<btSoftRigidDynamicsWorld*>(world);
+		int softBodyDrawFlags = softWorld ? softWorld->getDrawFlags() : fDrawFlags::Std;
+#endif
+		btCollisionObjectArray& objects = world->getCollisionObjectArray();
+		btScalar lodDistance2 = lodDistance * lodDistance;
+		btVector3 contactThreshold(gContactBreakingThreshold, gContactBreakingThreshold, gContactBreakingThreshold);
+		for (int i = 0; i < numObjects; i++)
+		{
+			btCollisionObject* colObj = objects[i];
+			if (!visible[i] || (colObj->getCollisionFlags() & btCollisionObject::CF_DISABLE_VISUALIZE_OBJECT))
+			{
+				continue;
+			}
+
+			btVector3 aabbMin, aabbMax;
+			colObj->getCollisionShape()->getAabb(colObj->getWorldTransform(), aabbMin, aabbMax);
+
+			if (debugMode & btIDebugDraw::DBG_DrawWireframe)
+			{
+				btVector3 color;
+				switch (colObj->getActivationState())
+				{
+				case ACTIVE_TAG:
+					color.setValue(1, 1, 1);
+					break;
+				case ISLAND_SLEEPING:
+					color.setValue(0, 1, 0);
+					break;
+				case WANTS_DEACTIVATION:
+					color.setValue(0, 1, 1);
+					break;
+				case DISABLE_DEACTIVATION:
+					color.setValue(1, 0, 0);
+					break;
+				case DISABLE_SIMULATION:
+					color.setValue(1, 1, 0);
+					break;
+				default:
+					color.setValue(1, 0, 0);
+				}
+
+				if (lodCenter && ((aabbMin + aabbMax) * btScalar(0.5) - *lodCenter).length2() > lodDistance2)
+				{
+					debugDrawer->drawAabb(aabbMin, aabbMax, color);
+				}
+				else
+				{
+#ifndef DISABLE_SOFTBODY
+					// Drawn like btSoftRigidDynamicsWorld::debugDrawWorld does,
+					// the node, face and cluster trees are left out.
+					btSoftBody* softBody = btSoftBody::upcast(colObj);
+					if (softBody)
+					{
+						btSoftBodyHelpers::DrawFrame(softBody, debugDrawer);
+						btSoftBodyHelpers::Draw(softBody, debugDrawer, softBodyDrawFlags);
+					}
+					else
+#endif
+					{
+						world->debugDrawObject(colObj->getWorldTransform(), colObj->getCollisionShape(), color);
+					}
+				}
+			}
+
+			if (debugMode & btIDebugDraw::DBG_DrawAabb)
+			{
+				debugDrawer->drawAabb(aabbMin - contactThreshold, aabbMax + contactThreshold, btVector3(1, 0, 0));
+			}
+		}
+	}
+
+#ifndef DISABLE_CONSTRAINTS
+	btDiscreteDynamicsWorld* dynamicsWorld = dynamic_cast<btDiscreteDynamicsWorld*>(world);
+	if (dynamicsWorld && (debugMode & (btIDebugDraw::DBG_DrawConstraints | btIDebugDraw::DBG_DrawConstraintLimits)))
+	{
+		int numConstraints = dynamicsWorld->getNumConstraints();
+		for (int i = 0; i < numConstraints; i++)
+		{
+			btTypedConstraint* constraint = dynamicsWorld->getConstraint(i);
+			int indexA = constraint->getRigidBodyA().getWorldArrayIndex();
+			int indexB = constraint->getRigidBodyB().getWorldArrayIndex();
+			if ((indexA >= 0 && indexA < numObjects && visible[indexA]) ||
+				(indexB >= 0 && indexB < numObjects && visible[indexB]))
+			{
+				dynamicsWorld->debugDrawConstraint(constraint);
+			}
+		}
+	}
+#endif
+}
+#pragma managed(pop)
+
+void CollisionWorld_PlanesToUnmanaged(array<Vector4>^ frustumPlanes, btScalar* planes)
+{
+	if (frustumPlanes == nullptr)
+		throw gcnew ArgumentNullException("frustumPlanes");
+
+	if (frustumPlanes->Length > 6)
+		throw gcnew ArgumentException("At most 6 planes are supported.", "frustumPlanes");
+
+	for (int i = 0; i < frustumPlanes->Length; i++)
+	{
+		planes[i*4] = Vector_X(frustumPlanes[i]);
+		planes[i*4+1] = Vector_Y(frustumPlanes[i]);
+		planes[i*4+2] = Vector_Z(frustumPlanes[i]);
+		planes[i*4+3] = Vector_W(frustumPlanes[i]);
+	}
+}
+
+void CollisionWorld::DebugDrawWorld(array<Vector4>^ frustumPlanes, Vector3 lodCenter, btScalar lodDistance)
+{
+	btScalar planes[24];
+	CollisionWorld_PlanesToUnmanaged(frustumPlanes, planes);
+
+	VECTOR3_CONV(lodCenter);
+	CollisionWorld_DebugDrawWorld(_native, planes, frustumPlanes->Length, 0, 0, VECTOR3_PTR(lodCenter), lodDistance);
+	VECTOR3_DEL(lodCenter);
+}
+
+void CollisionWorld::DebugDrawWorld(array<Vector4>^ frustumPlanes)
+{
+	btScalar planes[24];
+	CollisionWorld_PlanesToUnmanaged(frustumPlanes, planes);
+
+	CollisionWorld_DebugDrawWorld(_native, planes, frustumPlanes->Length, 0, 0, 0, 0);
+}
+
+void CollisionWorld::DebugDrawWorld(Vector3 aabbMin, Vector3 aabbMax, Vector3 lodCenter, btScalar lodDistance)
+{
+	VECTOR3_CONV(aabbMin);
+	VECTOR3_CONV(aabbMax);
+	VECTOR3_CONV(lodCenter);
+	CollisionWorld_DebugDrawWorld(_native, 0, 0, VECTOR3_PTR(aabbMin), VECTOR3_PTR(aabbMax), VECTOR3_PTR(lodCenter), lodDistance);
+	VECTOR3_DEL(aabbMin);
+	VECTOR3_DEL(aabbMax);
+	VECTOR3_DEL(lodCenter);
+}
+
+void CollisionWorld::DebugDrawWorld(Vector3 aabbMin, Vector3 aabbMax)
+{
+	VECTOR3_CONV(aabbMin);
+	VECTOR3_CONV(aabbMax);
+	CollisionWorld_DebugDrawWorld(_native, 0, 0, VECTOR3_PTR(aabbMin), VECTOR3_PTR(aabbMax), 0, 0);
+	VECTOR3_DEL(aabbMin);
+	VECTOR3_DEL(aabbMax);
+}
+#endif
+
+void CollisionWorld::ObjectQuerySingle(ConvexShape^ castShape, Matrix rayFromTrans,
+	Matrix rayToTrans, CollisionObject^ collisionObject, CollisionShape^ collisionShape,
+	Matrix colObjWorldTransform, ConvexResultCallback^ resultCallback, btScalar allowedPenetration)
+{
+	TRANSFORM_CONV(rayFromTrans);
+	TRANSFORM_CONV(rayToTrans);
+	TRANSFORM_CONV(colObjWorldTransform);
+	btCollisionWorld::objectQuerySingle((btConvexShape*)castShape->_native, TRANSFORM_USE(rayFromTrans),
+		TRANSFORM_USE(rayToTrans), collisionObject->_native, collisionShape->_native,
+		TRANSFORM_USE(colObjWorldTransform), *resultCallback->_native, allowedPenetration);
+	TRANSFORM_DEL(rayFromTrans);
+	TRANSFORM_DEL(rayToTrans);
+	TRANSFORM_DEL(colObjWorldTransform);
+}
+
+void CollisionWorld::PerformDiscreteCollisionDetection()
+{
+	_native->performDiscreteCollisionDetection();
+}
+
+void CollisionWorld::RayTest(Vector3 rayFromWorld, Vector3 rayToWorld, RayResultCallback^ resultCallback)
+{
+	VECTOR3_CONV(rayFromWorld);
+	VECTOR3_CONV(rayToWorld);
+	_native->rayTest(VECTOR3_USE(rayFromWorld), VECTOR3_USE(rayToWorld), *resultCallback->_native);
+	VECTOR3_DEL(rayFromWorld);
+	VECTOR3_DEL(rayToWorld);
+}
+
+void CollisionWorld::RayTest(Vector3% rayFromWorld, Vector3% rayToWorld, RayResultCallback^ resultCallback)
+{
+	VECTOR3_CONV(rayFromWorld);
+	VECTOR3_CONV(rayToWorld);
+	_native->rayTest(VECTOR3_USE(rayFromWorld), VECTOR3_USE(rayToWorld), *resultCallback->_native);
+	VECTOR3_DEL(rayFromWorld);
+	VECTOR3_DEL(rayToWorld);
+}
+
+#pragma managed(push, off)
+// Keeps the closest m_maxHits hits of one ray
+class BatchRayResultCallback : public btCollisionWorld::RayResultCallback
+{
+public:
+	btVector3 m_rayFromWorld;
+	btVector3 m_rayToWorld;
+	BatchQueryHit* m_hits;
+	int m_maxHits;
+	int m_numHits;
+
+	void reset(const btVector3& rayFromWorld, const btVector3& rayToWorld,
+		short int collisionFilterGroup, short int collisionFilterMask, BatchQueryHit* hits)
+	{
+		m_rayFromWorld = rayFromWorld;
+		m_rayToWorld = rayToWorld;
+		m_collisionFilterGroup = collisionFilterGroup;
+		m_collisionFilterMask = collisionFilterMask;
+		m_closestHitFraction = btScalar(1);
+		m_collisionObject = 0;
+		m_hits = hits;
+		m_numHits = 0;
+	}
+
+	virtual btScalar addSingleResult(btCollisionWorld::LocalRayResult& rayResult, bool normalInWorldSpace)
+	{
+		BatchQueryHit hit;
+		RayResultCallback_AddSingleResult(&rayResult, normalInWorldSpace,
+			&m_rayFromWorld, &m_rayToWorld, &hit.m_hitNormalWorld, &hit.m_hitPointWorld);
+		hit.m_collisionObject = rayResult.m_collisionObject;
+		hit.m_hitFraction = rayResult.m_hitFraction;
+		m_collisionObject = rayResult.m_collisionObject;
+		m_closestHitFraction = BatchQuery_InsertHit(m_hits, &m_numHits, m_maxHits, hit);
+		return m_closestHitFraction;
+	}
+};
+
+// btDbvtBroadphase::rayTest shares one traversal stack between all callers,
+// btDbvt::rayTest keeps it on the call stack, so worker threads can trace
+// rays through the same broadphase concurrently.
+struct BatchRayDbvtCollider : btDbvt::ICollide
+{
+	btTransform m_rayFromTrans;
+	btTransform m_rayToTrans;
+	btCollisionWorld::RayResultCallback* m_resultCallback;
+
+	void Process(const btDbvtNode* leaf)
+	{
+		btBroadphaseProxy* proxy = (btBroadphaseProxy*)leaf->data;
+		btCollisionObject* collisionObject = (btCollisionObject*)proxy->m_clientObject;
+		if (m_resultCallback->needsCollision(collisionObject->getBroadphaseHandle()))
+		{
+#ifndef DISABLE_SOFTBODY
+			// Soft bodies are traced through their faces like btSoftRigidDynamicsWorld::rayTest does
+			if (btSoftBody::upcast(collisionObject))
+			{
+				btSoftRigidDynamicsWorld::rayTestSingle(m_rayFromTrans, m_rayToTrans, collisionObject,
+					collisionObject->getCollisionShape(), collisionObject->getWorldTransform(), *m_resultCallback);
+				return;
+			}
+#endif
+			btCollisionWorld::rayTestSingle(m_rayFromTrans, m_rayToTrans, collisionObject,
+				collisionObject->getCollisionShape(), collisionObject->getWorldTransform(), *m_resultCallback);
+		}
+	}
+};
+
+#ifndef DISABLE_SOFTBODY
+// btSoftBody::rayTest builds a missing face tree on first use,
+// build them up front so that worker threads only read them.
+void CollisionWorld_InitializeFaceTrees(btSoftRigidDynamicsWorld* world)
+{
+	btSoftBodyArray& softBodies = world->getSoftBodyArray();
+	for (int i = 0; i < softBodies.size(); i++)
+	{
+		btSoftBody* softBody = softBodies[i];
+		if (softBody->m_faces.size() && softBody->m_fdbvt.empty())
+		{
+			softBody->initializeFaceTree();
+		}
+	}
+}
+#endif
+
+void CollisionWorld_RayTestBatch(const btCollisionWorld* world, const btDbvtBroadphase* dbvtBroadphase,
+	const btVector3* rayFromWorld, const btVector3* rayToWorld,
+	const int* collisionFilterGroups, const int* collisionFilterMasks, int start, int end,
+	BatchQueryHit* hits, int maxHits, int* hitCounts)
+{
+	BatchRayResultCallback resultCallback;
+	resultCallback.m_maxHits = maxHits;
+
+	BatchRayDbvtCollider collider;
+	collider.m_rayFromTrans.setIdentity();
+	collider.m_rayToTrans.setIdentity();
+	collider.m_resultCallback = &resultCallback;
+
+	for (int i = start; i < end; i++)
+	{
+		short int group = collisionFilterGroups ?
+			(short int)collisionFilterGroups[i] : (short int)btBroadphaseProxy::DefaultFilter;
+		short int mask = collisionFilterMasks ?
+			(short int)collisionFilterMasks[i] : (short int)btBroadphaseProxy::AllFilter;
+		resultCallback.reset(rayFromWorld[i], rayToWorld[i], group, mask, &hits[i * maxHits]);
+
+		if (dbvtBroadphase)
+		{
+			collider.m_rayFromTrans.setOrigin(rayFromWorld[i]);
+			collider.m_rayToTrans.setOrigin(rayToWorld[i]);
+			btDbvt::rayTest(dbvtBroadphase->m_sets[0].m_root, rayFromWorld[i], rayToWorld[i], collider);
+			btDbvt::rayTest(dbvtBroadphase->m_sets[1].m_root, rayFromWorld[i], rayToWorld[i], collider);
+		}
+		else
+		{
+			world->rayTest(rayFromWorld[i], rayToWorld[i], resultCallback);
+		}
+		hitCounts[i] = resultCallback.m_numHits;
+	}
+}
+#pragma managed(pop)
+
+ref class RayTestBatchJob
+{
+internal:
+	const btCollisionWorld* _world;
+	const btDbvtBroadphase* _dbvtBroadphase;
+	const btVector3* _rayFromWorld;
+	const btVector3* _rayToWorld;
+	const int* _collisionFilterGroups;
+	const int* _collisionFilterMasks;
+	BatchQueryHit* _hits;
+	int* _hitCounts;
+	int _maxHits;
+	int _numRays;
+	int _raysPerJob;
+
+	void Run(int job)
+	{
+		int start = job * _raysPerJob;
+		int end = btMin(start + _raysPerJob, _numRays);
+		CollisionWorld_RayTestBatch(_world, _dbvtBroadphase, _rayFromWorld, _rayToWorld,
+			_collisionFilterGroups, _collisionFilterMasks, start, end, _hits, _maxHits, _hitCounts);
+	}
+};
+
+void CollisionWorld::RayTestBatch(array<Vector3>^ rayFromWorld, array<Vector3>^ rayToWorld,
+	array<CollisionFilterGroups>^ collisionFilterGroups, array<CollisionFilterGroups>^ collisionFilterMasks,
+	BatchQueryResults^ results, int numThreads)
+{
+	if (rayFromWorld == nullptr)
+		throw gcnew ArgumentNullException("rayFromWorld");
+	if (rayToWorld == nullptr)
+		throw gcnew ArgumentNullException("rayToWorld");
+	if (results == nullptr)
+		throw gcnew ArgumentNullException("results");
+
+	int numRays = rayFromWorld->Length;
+	if (rayToWorld->Length != numRays)
+		throw gcnew ArgumentException("Array lengths do not match.", "rayToWorld");
+	BatchQuery_CheckFilterArrays(collisionFilterGroups, collisionFilterMasks, numRays);
+
+	results->Reserve(numRays);
+	results->_numQueries = 0;
+	if (numRays == 0)
+		return;
+
+	int maxHits = results->_maxHitsPerQuery;
+	BatchQueryBuffers* buffers = results->_buffers;
+	buffers->m_rayFromWorld.resizeNoInitialize(numRays);
+	buffers->m_rayToWorld.resizeNoInitialize(numRays);
+	for (int i = 0; i < numRays; i++)
+	{
+		Math::Vector3ToBtVector3(rayFromWorld[i], &buffers->m_rayFromWorld[i]);
+		Math::Vector3ToBtVector3(rayToWorld[i], &buffers->m_rayToWorld[i]);
+	}
+	btVector3* rayFromWorldTemp = &buffers->m_rayFromWorld[0];
+	btVector3* rayToWorldTemp = &buffers->m_rayToWorld[0];
+	BatchQueryHit* hits = &buffers->m_hits[0];
+
+	pin_ptr<CollisionFilterGroups> collisionFilterGroupsPtr;
+	if (collisionFilterGroups != nullptr)
+		collisionFilterGroupsPtr = &collisionFilterGroups[0];
+	pin_ptr<CollisionFilterGroups> collisionFilterMasksPtr;
+	if (collisionFilterMasks != nullptr)
+		collisionFilterMasksPtr = &collisionFilterMasks[0];
+	pin_ptr<int> hitCountsPtr = &results->_hitCounts[0];
+
+	// Worker threads need a broadphase that can be traversed concurrently
+	btDbvtBroadphase* dbvtBroadphase = (numThreads > 1) ? dynamic_cast<btDbvtBroadphase*>(_native->getBroadphase()) : 0;
+	if (dbvtBroadphase)
+	{
+#ifndef DISABLE_SOFTBODY
+		btSoftRigidDynamicsWorld* softWorld = dynamic_cast<btSoftRigidDynamicsWorld*>(_native);
+		if (softWorld)
+		{
+			CollisionWorld_InitializeFaceTrees(softWorld);
+		}
+#endif
+
+		int numJobs = btMin(numThreads, numRays);
+		RayTestBatchJob^ job = gcnew RayTestBatchJob();
+		job->_world = _native;
+		job->_dbvtBroadphase = dbvtBroadphase;
+		job->_rayFromWorld = rayFromWorldTemp;
+		job->_rayToWorld = rayToWorldTemp;
+		job->_collisionFilterGroups = (int*)(CollisionFilterGroups*)collisionFilterGroupsPtr;
+		job->_collisionFilterMasks = (int*)(CollisionFilterGroups*)collisionFilterMasksPtr;
+		job->_hits = hits;
+		job->_hitCounts = hitCountsPtr;
+		job->_maxHits = maxHits;
+		job->_numRays = numRays;
+		job->_raysPerJob = (numRays + numJobs - 1) / numJobs;
+		System::Threading::Tasks::Parallel::For(0, numJobs, gcnew Action<int>(job, &RayTestBatchJob::Run));
+	}
+	else
+	{
+		CollisionWorld_RayTestBatch(_native, 0, rayFromWorldTemp, rayToWorldTemp,
+			(int*)(CollisionFilterGroups*)collisionFilterGroupsPtr, (int*)(CollisionFilterGroups*)collisionFilterMasksPtr,
+			0, numRays, hits, maxHits, hitCountsPtr);
+	}
+
+	BatchQueryResults_CopyHits(results, hits, numRays, _collisionObjectArray);
+}
+
+void CollisionWorld::RayTestBatch(array<Vector3>^ rayFromWorld, array<Vector3>^ rayToWorld,
+	array<CollisionFilterGroups>^ collisionFilterGroups, array<CollisionFilterGroups>^ collisionFilterMasks,
+	BatchQueryResults^ results)
+{
+	RayTestBatch(rayFromWorld, rayToWorld, collisionFilterGroups, collisionFilterMasks, results, 1);
+}
+
+void CollisionWorld::RayTestBatch(array<Vector3>^ rayFromWorld, array<Vector3>^ rayToWorld,
+	BatchQueryResults^ results)
+{
+	RayTestBatch(rayFromWorld, rayToWorld, nullptr, nullptr, results, 1);
 }
 
 void CollisionWorld::RayTestSingle(Matrix rayFromTrans, Matrix rayToTrans, CollisionObject^ collisionObject,
@@ -1030,10 +2583,12 @@ void CollisionWorld::Dispatcher::set(BulletSharp::Dispatcher^ dispatcher)
 {
 	if (_dispatcher) {
 		_dispatcher->_dispatcherInfoRefs->Remove(IntPtr(DispatchInfo->_native));
+		_dispatcher->_collisionObjectArray = nullptr;
 	}
 	_dispatcher = dispatcher;
 	if (dispatcher) {
 		dispatcher->_dispatcherInfoRefs->Add(IntPtr(DispatchInfo->_native), DispatchInfo);
+		dispatcher->_collisionObjectArray = _collisionObjectArray;
 	}
 }
 
@@ -19,6 +19,7 @@ namespace BulletSharp
 	ref class Serializer;
 	interface class IDebugDraw;
 
+	class BatchQueryBuffers;
 	class ContactResultCallbackWrapper;
 	class DebugDrawWrapper;
 
@@ -115,6 +116,8 @@ namespace BulletSharp
 	internal:
 		btCollisionWorld::RayResultCallback* _native;
 
+		RayResultCallback(btCollisionWorld::RayResultCallback* native);
+
 	public:
 		!RayResultCallback();
 	protected:
@@ -291,6 +294,8 @@ namespace BulletSharp
 	internal:
 		btCollisionWorld::ConvexResultCallback* _native;
 
+		ConvexResultCallback(btCollisionWorld::ConvexResultCallback* native);
+
 	public:
 		!ConvexResultCallback();
 	protected:
@@ -430,6 +435,284 @@ namespace BulletSharp
 		}
 	};
 
+	// Object set and user index filter evaluated natively by the Native*ResultCallback presets
+	class NativeCollisionObjectFilter
+	{
+	public:
+		btAlignedObjectArray<const btCollisionObject*> m_objects; // sorted for binary search
+		int m_objectFilterMode;
+		int m_userIndex;
+		int m_userIndexFilterMode;
+
+		NativeCollisionObjectFilter();
+
+		bool passes(const btCollisionObject* collisionObject) const;
+		void sortObjects();
+	};
+
+	struct NativeResultFilter
+	{
+		const btCollisionObject* m_ignoredObject;
+		const NativeCollisionObjectFilter* m_filter;
+
+		bool needsCollision(const btBroadphaseProxy* proxy0) const;
+	};
+
+	public ref class CollisionObjectFilter
+	{
+	internal:
+		NativeCollisionObjectFilter* _native;
+
+	public:
+		!CollisionObjectFilter();
+	protected:
+		~CollisionObjectFilter();
+
+	public:
+		CollisionObjectFilter();
+
+		void SetObjects(array<BulletSharp::CollisionObject^>^ objects, CollisionObjectFilterMode mode);
+		void SetUserIndex(int userIndex, CollisionObjectFilterMode mode);
+
+		property bool IsDisposed
+		{
+			virtual bool get();
+		}
+
+		property int NumObjects
+		{
+			int get();
+		}
+
+		property CollisionObjectFilterMode ObjectFilterMode
+		{
+			CollisionObjectFilterMode get();
+			void set(CollisionObjectFilterMode value);
+		}
+
+		property int UserIndex
+		{
+			int get();
+			void set(int value);
+		}
+
+		property CollisionObjectFilterMode UserIndexFilterMode
+		{
+			CollisionObjectFilterMode get();
+			void set(CollisionObjectFilterMode value);
+		}
+	};
+
+	// Base of ray callbacks that filter and collect hits without calling into managed code
+	public ref class NativeRayResultCallback abstract : RayResultCallback
+	{
+	private:
+		CollisionObjectFilter^ _filter;
+		BulletSharp::CollisionObject^ _ignoredObject;
+
+	internal:
+		NativeResultFilter* _resultFilter;
+
+		NativeRayResultCallback(btCollisionWorld::RayResultCallback* native);
+
+	public:
+		!NativeRayResultCallback();
+	protected:
+		~NativeRayResultCallback();
+
+	public:
+		virtual btScalar AddSingleResult(LocalRayResult^ rayResult, bool normalInWorldSpace) override;
+		virtual bool NeedsCollision(BroadphaseProxy^ proxy0) override;
+		virtual void Reset();
+
+		property CollisionObjectFilter^ Filter
+		{
+			CollisionObjectFilter^ get();
+			void set(CollisionObjectFilter^ value);
+		}
+
+		property BulletSharp::CollisionObject^ IgnoredObject
+		{
+			BulletSharp::CollisionObject^ get();
+			void set(BulletSharp::CollisionObject^ value);
+		}
+	};
+
+	public ref class NativeClosestRayResultCallback : NativeRayResultCallback
+	{
+	internal:
+		NativeClosestRayResultCallback(Vector3 rayFromWorld, Vector3 rayToWorld,
+			BulletSharp::CollisionObject^ ignoredObject, bool anyHit);
+
+	public:
+		NativeClosestRayResultCallback(Vector3 rayFromWorld, Vector3 rayToWorld);
+		NativeClosestRayResultCallback(Vector3 rayFromWorld, Vector3 rayToWorld,
+			BulletSharp::CollisionObject^ ignoredObject);
+
+		property Vector3 HitNormalWorld
+		{
+			Vector3 get();
+		}
+
+		property Vector3 HitPointWorld
+		{
+			Vector3 get();
+		}
+
+		property Vector3 RayFromWorld
+		{
+			Vector3 get();
+			void set(Vector3 value);
+		}
+
+		property Vector3 RayToWorld
+		{
+			Vector3 get();
+			void set(Vector3 value);
+		}
+	};
+
+	// Stops at the first hit found, which is not necessarily the closest one
+	public ref class NativeAnyHitRayResultCallback : NativeClosestRayResultCallback
+	{
+	public:
+		NativeAnyHitRayResultCallback(Vector3 rayFromWorld, Vector3 rayToWorld);
+		NativeAnyHitRayResultCallback(Vector3 rayFromWorld, Vector3 rayToWorld,
+			BulletSharp::CollisionObject^ ignoredObject);
+	};
+
+	public ref class NativeAllHitsRayResultCallback : NativeRayResultCallback
+	{
+	private:
+		System::Collections::ObjectModel::ReadOnlyCollection<BulletSharp::CollisionObject^>^ _collisionObjects;
+		AlignedScalarArray^ _hitFractions;
+		AlignedVector3Array^ _hitNormalWorld;
+		AlignedVector3Array^ _hitPointWorld;
+
+	public:
+		NativeAllHitsRayResultCallback(Vector3 rayFromWorld, Vector3 rayToWorld);
+
+		virtual void Reset() override;
+
+		// Read-only view of the native hit objects
+		property System::Collections::ObjectModel::ReadOnlyCollection<BulletSharp::CollisionObject^>^ CollisionObjects
+		{
+			System::Collections::ObjectModel::ReadOnlyCollection<BulletSharp::CollisionObject^>^ get();
+		}
+
+		property AlignedScalarArray^ HitFractions
+		{
+			AlignedScalarArray^ get();
+		}
+
+		property AlignedVector3Array^ HitNormalWorld
+		{
+			AlignedVector3Array^ get();
+		}
+
+		property AlignedVector3Array^ HitPointWorld
+		{
+			AlignedVector3Array^ get();
+		}
+
+		property Vector3 RayFromWorld
+		{
+			Vector3 get();
+			void set(Vector3 value);
+		}
+
+		property Vector3 RayToWorld
+		{
+			Vector3 get();
+			void set(Vector3 value);
+		}
+	};
+
+	// Base of convex callbacks that filter and collect hits without calling into managed code
+	public ref class NativeConvexResultCallback abstract : ConvexResultCallback
+	{
+	private:
+		CollisionObjectFilter^ _filter;
+		BulletSharp::CollisionObject^ _ignoredObject;
+
+	internal:
+		NativeResultFilter* _resultFilter;
+
+		NativeConvexResultCallback(btCollisionWorld::ConvexResultCallback* native);
+
+	public:
+		!NativeConvexResultCallback();
+	protected:
+		~NativeConvexResultCallback();
+
+	public:
+		virtual btScalar AddSingleResult(LocalConvexResult^ convexResult, bool normalInWorldSpace) override;
+		virtual bool NeedsCollision(BroadphaseProxy^ proxy0) override;
+		virtual void Reset();
+
+		property CollisionObjectFilter^ Filter
+		{
+			CollisionObjectFilter^ get();
+			void set(CollisionObjectFilter^ value);
+		}
+
+		property BulletSharp::CollisionObject^ IgnoredObject
+		{
+			BulletSharp::CollisionObject^ get();
+			void set(BulletSharp::CollisionObject^ value);
+		}
+	};
+
+	public ref class NativeClosestConvexResultCallback : NativeConvexResultCallback
+	{
+	internal:
+		NativeClosestConvexResultCallback(Vector3 convexFromWorld, Vector3 convexToWorld,
+			BulletSharp::CollisionObject^ ignoredObject, bool anyHit);
+
+	public:
+		NativeClosestConvexResultCallback(Vector3 convexFromWorld, Vector3 convexToWorld);
+		NativeClosestConvexResultCallback(Vector3 convexFromWorld, Vector3 convexToWorld,
+			BulletSharp::CollisionObject^ ignoredObject);
+
+		virtual void Reset() override;
+
+		property Vector3 ConvexFromWorld
+		{
+			Vector3 get();
+			void set(Vector3 value);
+		}
+
+		property Vector3 ConvexToWorld
+		{
+			Vector3 get();
+			void set(Vector3 value);
+		}
+
+		property BulletSharp::CollisionObject^ HitCollisionObject
+		{
+			BulletSharp::CollisionObject^ get();
+		}
+
+		property Vector3 HitNormalWorld
+		{
+			Vector3 get();
+		}
+
+		property Vector3 HitPointWorld
+		{
+			Vector3 get();
+		}
+	};
+
+	// Stops at the first hit found, which is not necessarily the closest one
+	public ref class NativeAnyHitConvexResultCallback : NativeClosestConvexResultCallback
+	{
+	public:
+		NativeAnyHitConvexResultCallback(Vector3 convexFromWorld, Vector3 convexToWorld);
+		NativeAnyHitConvexResultCallback(Vector3 convexFromWorld, Vector3 convexToWorld,
+			BulletSharp::CollisionObject^ ignoredObject);
+	};
+
 	public ref class ContactResultCallback abstract
 	{
 	internal:
@@ -481,6 +764,89 @@ namespace BulletSharp
 			const btCollisionObjectWrapper* colObj1, int partId1, int index1);
 	};
 
+	// Results of a batched world query, stored ray-major:
+	// the hits of query i are at [i * MaxHitsPerQuery, i * MaxHitsPerQuery + HitCounts[i]),
+	// sorted by hit fraction.
+	// The native buffers passed to Bullet are kept between batches and released by Dispose.
+	public ref class BatchQueryResults
+	{
+	internal:
+		// Native inputs and hits of the last batch, kept to avoid allocating per batch
+		BatchQueryBuffers* _buffers;
+		array<int>^ _collisionObjectHandles;
+		array<int>^ _collisionObjectIndices;
+		array<BulletSharp::CollisionObject^>^ _collisionObjects;
+		bool _collisionObjectsResolved;
+		AlignedCollisionObjectArray^ _objectTable;
+		array<int>^ _hitCounts;
+		array<btScalar>^ _hitFractions;
+		array<Vector3>^ _hitNormalsWorld;
+		array<Vector3>^ _hitPointsWorld;
+		int _maxHitsPerQuery;
+		int _numQueries;
+
+		void Reserve(int numQueries);
+
+	public:
+		!BatchQueryResults();
+	protected:
+		~BatchQueryResults();
+
+	public:
+		BatchQueryResults();
+		BatchQueryResults(int maxHitsPerQuery);
+		BatchQueryResults(int maxHitsPerQuery, int queryCapacity);
+
+		// CollisionObject.WorldHandle of the hit object, 0 for empty slots
+		property array<int>^ CollisionObjectHandles
+		{
+			array<int>^ get();
+		}
+
+		// Index of the hit object in CollisionWorld.CollisionObjectArray, -1 for empty slots
+		property array<int>^ CollisionObjectIndices
+		{
+			array<int>^ get();
+		}
+
+		// Resolved from CollisionObjectHandles on first access after a query.
+		// Objects removed from the world since the query are null.
+		property array<BulletSharp::CollisionObject^>^ CollisionObjects
+		{
+			array<BulletSharp::CollisionObject^>^ get();
+		}
+
+		property array<int>^ HitCounts
+		{
+			array<int>^ get();
+		}
+
+		property array<btScalar>^ HitFractions
+		{
+			array<btScalar>^ get();
+		}
+
+		property array<Vector3>^ HitNormalsWorld
+		{
+			array<Vector3>^ get();
+		}
+
+		property array<Vector3>^ HitPointsWorld
+		{
+			array<Vector3>^ get();
+		}
+
+		property int MaxHitsPerQuery
+		{
+			int get();
+		}
+
+		property int NumQueries
+		{
+			int get();
+		}
+	};
+
 	public ref class CollisionWorld
 	{
 	internal:
@@ -519,9 +885,29 @@ namespace BulletSharp
 		void ConvexSweepTest(ConvexShape^ castShape, Matrix from, Matrix to, ConvexResultCallback^ resultCallback,
 			btScalar allowedCcdPenetration);
 		void ConvexSweepTest(ConvexShape^ castShape, Matrix from, Matrix to, ConvexResultCallback^ resultCallback);
+		void ConvexSweepTestBatch(array<ConvexShape^>^ castShapes, array<Matrix>^ from, array<Matrix>^ to,
+			array<CollisionFilterGroups>^ collisionFilterGroups, array<CollisionFilterGroups>^ collisionFilterMasks,
+			BatchQueryResults^ results, btScalar allowedCcdPenetration, int numThreads);
+		void ConvexSweepTestBatch(array<ConvexShape^>^ castShapes, array<Matrix>^ from, array<Matrix>^ to,
+			array<CollisionFilterGroups>^ collisionFilterGroups, array<CollisionFilterGroups>^ collisionFilterMasks,
+			BatchQueryResults^ results);
+		void ConvexSweepTestBatch(array<ConvexShape^>^ castShapes, array<Matrix>^ from, array<Matrix>^ to,
+			BatchQueryResults^ results);
+		void ConvexSweepTestBatch(ConvexShape^ castShape, array<Matrix>^ from, array<Matrix>^ to,
+			BatchQueryResults^ results);
+		// Returns the object with the given CollisionObject.WorldHandle
+		CollisionObject^ GetCollisionObject(int handle);
 #ifndef DISABLE_DEBUGDRAW
 		void DebugDrawObject(Matrix worldTransform, CollisionShape^ shape, BtColor color);
 		void DebugDrawWorld();
+		// Draws only the objects that overlap the frustum or the region, found through the broadphase.
+		// Planes are (normal, d) with the inside where dot(normal, p) + d >= 0.
+		// Wireframes of objects further than lodDistance from lodCenter are replaced by their AABB.
+		// Soft bodies are drawn with SoftRigidDynamicsWorld.DrawFlags, but without their node, face and cluster trees.
+		void DebugDrawWorld(array<Vector4>^ frustumPlanes, Vector3 lodCenter, btScalar lodDistance);
+		void DebugDrawWorld(array<Vector4>^ frustumPlanes);
+		void DebugDrawWorld(Vector3 aabbMin, Vector3 aabbMax, Vector3 lodCenter, btScalar lodDistance);
+		void DebugDrawWorld(Vector3 aabbMin, Vector3 aabbMax);
 #endif
 		static void ObjectQuerySingle(ConvexShape^ castShape, Matrix rayFromTrans,
 			Matrix rayToTrans, CollisionObject^ collisionObject, CollisionShape^ collisionShape,
@@ -529,6 +915,13 @@ namespace BulletSharp
 		void PerformDiscreteCollisionDetection();
 		void RayTest(Vector3 rayFromWorld, Vector3 rayToWorld, RayResultCallback^ resultCallback);
 		void RayTest(Vector3% rayFromWorld, Vector3% rayToWorld, RayResultCallback^ resultCallback);
+		void RayTestBatch(array<Vector3>^ rayFromWorld, array<Vector3>^ rayToWorld,
+			array<CollisionFilterGroups>^ collisionFilterGroups, array<CollisionFilterGroups>^ collisionFilterMasks,
+			BatchQueryResults^ results, int numThreads);
+		void RayTestBatch(array<Vector3>^ rayFromWorld, array<Vector3>^ rayToWorld,
+			array<CollisionFilterGroups>^ collisionFilterGroups, array<CollisionFilterGroups>^ collisionFilterMasks,
+			BatchQueryResults^ results);
+		void RayTestBatch(array<Vector3>^ rayFromWorld, array<Vector3>^ rayToWorld, BatchQueryResults^ results);
 		static void RayTestSingle(Matrix rayFromTrans, Matrix rayToTrans, CollisionObject^ collisionObject,
 			CollisionShape^ collisionShape, Matrix colObjWorldTransform, RayResultCallback^ resultCallback);
 		void RemoveCollisionObject(CollisionObject^ collisionObject);
@@ -97,15 +97,14 @@ void CompoundShape::CalculatePrincipalAxisTransform(array<btScalar>^ masses, Mat
 	[Out] Vector3% inertia)
 {
 	pin_ptr<btScalar> massesPtr = &masses[0];
-	btTransform* principalTemp = Math::MatrixToBtTransform(principal);
-	btVector3* inertiaTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btTransform, principalTemp);
+	Math::MatrixToBtTransform(principal, principalTemp);
+	ALIGNED_STACK(btVector3, inertiaTemp);
 	
 	Native->calculatePrincipalAxisTransform(massesPtr, *principalTemp, *inertiaTemp);
 	Math::BtTransformToMatrix(principalTemp, principal);
 	Math::BtVector3ToVector3(inertiaTemp, inertia);
 	
-	ALIGNED_FREE(principalTemp);
-	ALIGNED_FREE(inertiaTemp);
 }
 
 void CompoundShape::CreateAabbTreeFromChildren()
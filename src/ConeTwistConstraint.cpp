@@ -88,10 +88,9 @@ void ConeTwistConstraint_GetPointForAngle(btConeTwistConstraint* constraint,
 #pragma managed(pop)
 Vector3 ConeTwistConstraint::GetPointForAngle(btScalar fAngleInRadians, btScalar fLength)
 {
-	btVector3* pointTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, pointTemp);
 	ConeTwistConstraint_GetPointForAngle(Native, fAngleInRadians, fLength, pointTemp);
 	Vector3 point = Math::BtVector3ToVector3(pointTemp);
-	ALIGNED_FREE(pointTemp);
 	return point;
 }
 
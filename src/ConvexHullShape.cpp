@@ -8,7 +8,7 @@
 ConvexHullShape::ConvexHullShape(IEnumerable<Vector3>^ points)
 : PolyhedralConvexAabbCachingShape(new btConvexHullShape())
 {
-	btVector3* pointTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, pointTemp);
 
 	for each (Vector3 point in points)
 	{
@@ -17,7 +17,6 @@ ConvexHullShape::ConvexHullShape(IEnumerable<Vector3>^ points)
 	}
 	Native->recalcLocalAabb();
 
-	ALIGNED_FREE(pointTemp);
 }
 
 ConvexHullShape::ConvexHullShape()
@@ -47,10 +46,9 @@ void ConvexHullShape_GetScaledPoint(btConvexHullShape* shape, int i, btVector3*
 #pragma managed(pop)
 Vector3 ConvexHullShape::GetScaledPoint(int i)
 {
-	btVector3* pointTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, pointTemp);
 	ConvexHullShape_GetScaledPoint(Native, i, pointTemp);
 	Vector3 point = Math::BtVector3ToVector3(pointTemp);
-	ALIGNED_FREE(pointTemp);
 	return point;
 }
 
@@ -61,8 +59,8 @@ void ConvexHullShape::Project(Matrix trans, Vector3 dir, btScalar% minProj, btSc
 	VECTOR3_CONV(dir);
 	btScalar minProjTemp;
 	btScalar maxProjTemp;
-	btVector3* witnesPtMinTemp = ALIGNED_NEW(btVector3);
-	btVector3* witnesPtMaxTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, witnesPtMinTemp);
+	ALIGNED_STACK(btVector3, witnesPtMaxTemp);
 	Native->project(TRANSFORM_USE(trans), VECTOR3_USE(dir), minProjTemp, maxProjTemp,
 		*witnesPtMinTemp, *witnesPtMaxTemp);
 	minProj = minProjTemp;
@@ -71,8 +69,6 @@ void ConvexHullShape::Project(Matrix trans, Vector3 dir, btScalar% minProj, btSc
 	Math::BtVector3ToVector3(witnesPtMaxTemp, witnesPtMax);
 	TRANSFORM_DEL(trans);
 	VECTOR3_DEL(dir);
-	ALIGNED_FREE(witnesPtMinTemp);
-	ALIGNED_FREE(witnesPtMaxTemp);
 }
 
 int ConvexHullShape::NumPoints::get()
@@ -37,9 +37,9 @@ bool ConvexPenetrationDepthSolver::CalcPenDepth(SimplexSolverInterface^ simplexS
 {
 	TRANSFORM_CONV(transA);
 	TRANSFORM_CONV(transB);
-	btVector3* vTemp = ALIGNED_NEW(btVector3);
-	btVector3* paTemp = ALIGNED_NEW(btVector3);
-	btVector3* pbTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, vTemp);
+	ALIGNED_STACK(btVector3, paTemp);
+	ALIGNED_STACK(btVector3, pbTemp);
 
 	bool ret;
 #ifndef DISABLE_DEBUGDRAW
@@ -67,9 +67,6 @@ bool ConvexPenetrationDepthSolver::CalcPenDepth(SimplexSolverInterface^ simplexS
 	Math::BtVector3ToVector3(vTemp, v);
 	Math::BtVector3ToVector3(paTemp, pa);
 	Math::BtVector3ToVector3(pbTemp, pb);
-	ALIGNED_FREE(vTemp);
-	ALIGNED_FREE(paTemp);
-	ALIGNED_FREE(pbTemp);
 	return ret;
 }
 
@@ -33,10 +33,9 @@ void ConvexPointCloudShape_GetScaledPoint(btConvexPointCloudShape* shape, int i,
 #pragma managed(pop)
 Vector3 ConvexPointCloudShape::GetScaledPoint(int i)
 {
-	btVector3* pointTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, pointTemp);
 	ConvexPointCloudShape_GetScaledPoint(Native, i, pointTemp);
 	Vector3 point = Math::BtVector3ToVector3(pointTemp);
-	ALIGNED_FREE(pointTemp);
 	return point;
 }
 
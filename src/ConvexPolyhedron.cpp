@@ -86,8 +86,8 @@ void ConvexPolyhedron::ProjectRef(Matrix% transform, Vector3% direction, [Out] b
 	VECTOR3_CONV(direction);
 	btScalar minProjTemp;
 	btScalar maxProjTemp;
-	btVector3* witnesPtMinTemp = ALIGNED_NEW(btVector3);
-	btVector3* witnesPtMaxTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, witnesPtMinTemp);
+	ALIGNED_STACK(btVector3, witnesPtMaxTemp);
 	_native->project(TRANSFORM_USE(transform), VECTOR3_USE(direction), minProjTemp, maxProjTemp,
 		VECTOR3_USE(witnesPtMin), VECTOR3_USE(witnesPtMax));
 	minProj = minProjTemp;
@@ -96,8 +96,6 @@ void ConvexPolyhedron::ProjectRef(Matrix% transform, Vector3% direction, [Out] b
 	witnesPtMax = Math::BtVector3ToVector3(witnesPtMaxTemp);
 	VECTOR3_DEL(direction);
 	TRANSFORM_DEL(transform);
-	ALIGNED_FREE(witnesPtMaxTemp);
-	ALIGNED_FREE(witnesPtMinTemp);
 }
 
 void ConvexPolyhedron::Project(Matrix transform, Vector3 direction, [Out] btScalar% minProj, [Out] btScalar% maxProj,
@@ -107,8 +105,8 @@ void ConvexPolyhedron::Project(Matrix transform, Vector3 direction, [Out] btScal
 	VECTOR3_CONV(direction);
 	btScalar minProjTemp;
 	btScalar maxProjTemp;
-	btVector3* witnesPtMinTemp = ALIGNED_NEW(btVector3);
-	btVector3* witnesPtMaxTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, witnesPtMinTemp);
+	ALIGNED_STACK(btVector3, witnesPtMaxTemp);
 	_native->project(TRANSFORM_USE(transform), VECTOR3_USE(direction), minProjTemp, maxProjTemp,
 		VECTOR3_USE(witnesPtMin), VECTOR3_USE(witnesPtMax));
 	minProj = minProjTemp;
@@ -117,8 +115,6 @@ void ConvexPolyhedron::Project(Matrix transform, Vector3 direction, [Out] btScal
 	witnesPtMax = Math::BtVector3ToVector3(witnesPtMaxTemp);
 	VECTOR3_DEL(direction);
 	TRANSFORM_DEL(transform);
-	ALIGNED_FREE(witnesPtMaxTemp);
-	ALIGNED_FREE(witnesPtMinTemp);
 }
 
 bool ConvexPolyhedron::TestContainment()
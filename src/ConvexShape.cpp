@@ -25,35 +25,30 @@ void ConvexShape::BatchedUnitVectorGetSupportingVertexWithoutMargin(array<Vector
 void ConvexShape::GetAabbNonVirtual(Matrix t, Vector3% aabbMin, Vector3% aabbMax)
 {
 	TRANSFORM_CONV(t);
-	btVector3* aabbMinTemp = ALIGNED_NEW(btVector3);
-	btVector3* aabbMaxTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, aabbMinTemp);
+	ALIGNED_STACK(btVector3, aabbMaxTemp);
 	Native->getAabbNonVirtual(TRANSFORM_USE(t), *aabbMinTemp, *aabbMaxTemp);
 	TRANSFORM_DEL(t);
 	Math::BtVector3ToVector3(aabbMinTemp, aabbMin);
 	Math::BtVector3ToVector3(aabbMaxTemp, aabbMax);
-	ALIGNED_FREE(aabbMinTemp);
-	ALIGNED_FREE(aabbMaxTemp);
 }
 
 void ConvexShape::GetAabbSlow(Matrix t, Vector3% aabbMin, Vector3% aabbMax)
 {
 	TRANSFORM_CONV(t);
-	btVector3* aabbMinTemp = ALIGNED_NEW(btVector3);
-	btVector3* aabbMaxTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, aabbMinTemp);
+	ALIGNED_STACK(btVector3, aabbMaxTemp);
 	Native->getAabbSlow(TRANSFORM_USE(t), *aabbMinTemp, *aabbMaxTemp);
 	TRANSFORM_DEL(t);
 	Math::BtVector3ToVector3(aabbMinTemp, aabbMin);
 	Math::BtVector3ToVector3(aabbMaxTemp, aabbMax);
-	ALIGNED_FREE(aabbMinTemp);
-	ALIGNED_FREE(aabbMaxTemp);
 }
 
 void ConvexShape::GetPreferredPenetrationDirection(int index, [Out] Vector3% penetrationVector)
 {
-	btVector3* penetrationVectorTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, penetrationVectorTemp);
 	Native->getPreferredPenetrationDirection(index, *penetrationVectorTemp);
 	Math::BtVector3ToVector3(penetrationVectorTemp, penetrationVector);
-	ALIGNED_FREE(penetrationVectorTemp);
 }
 
 #pragma managed(push, off)
@@ -77,44 +72,40 @@ void ConvexShape_LocalGetSupportVertexWithoutMarginNonVirtual(btConvexShape* sha
 Vector3 ConvexShape::LocalGetSupportingVertex(Vector3 vec)
 {
 	VECTOR3_CONV(vec);
-	btVector3* vecOut = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, vecOut);
 	ConvexShape_LocalGetSupportingVertex(Native, VECTOR3_PTR(vec), vecOut);
 	VECTOR3_DEL(vec);
 	Vector3 ret = Math::BtVector3ToVector3(vecOut);
-	ALIGNED_FREE(vecOut);
 	return ret;
 }
 
 Vector3 ConvexShape::LocalGetSupportingVertexWithoutMargin(Vector3 vec)
 {
 	VECTOR3_CONV(vec);
-	btVector3* vecOut = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, vecOut);
 	ConvexShape_LocalGetSupportingVertexWithoutMargin(Native, VECTOR3_PTR(vec), vecOut);
 	VECTOR3_DEL(vec);
 	Vector3 ret = Math::BtVector3ToVector3(vecOut);
-	ALIGNED_FREE(vecOut);
 	return ret;
 }
 
 Vector3 ConvexShape::LocalGetSupportVertexNonVirtual(Vector3 vec)
 {
 	VECTOR3_CONV(vec);
-	btVector3* vecOut = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, vecOut);
 	ConvexShape_LocalGetSupportVertexNonVirtual(Native, VECTOR3_PTR(vec), vecOut);
 	VECTOR3_DEL(vec);
 	Vector3 ret = Math::BtVector3ToVector3(vecOut);
-	ALIGNED_FREE(vecOut);
 	return ret;
 }
 
 Vector3 ConvexShape::LocalGetSupportVertexWithoutMarginNonVirtual(Vector3 vec)
 {
 	VECTOR3_CONV(vec);
-	btVector3* vecOut = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, vecOut);
 	ConvexShape_LocalGetSupportVertexWithoutMarginNonVirtual(Native, VECTOR3_PTR(vec), vecOut);
 	VECTOR3_DEL(vec);
 	Vector3 ret = Math::BtVector3ToVector3(vecOut);
-	ALIGNED_FREE(vecOut);
 	return ret;
 }
 
@@ -28,7 +28,7 @@ void ConvexTriangleMeshShape::CalculatePrincipalAxisTransform(Matrix% principal,
 	[Out] btScalar% volume)
 {
 	TRANSFORM_CONV(principal);
-	btVector3* inertiaTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, inertiaTemp);
 	btScalar volumeTemp;
 	Native->calculatePrincipalAxisTransform(TRANSFORM_USE(principal), *inertiaTemp,
 		volumeTemp);
@@ -36,7 +36,6 @@ void ConvexTriangleMeshShape::CalculatePrincipalAxisTransform(Matrix% principal,
 	Math::BtVector3ToVector3(inertiaTemp, inertia);
 	volume = volumeTemp;
 	TRANSFORM_DEL(principal);
-	ALIGNED_FREE(inertiaTemp);
 }
 
 StridingMeshInterface^ ConvexTriangleMeshShape::MeshInterface::get()
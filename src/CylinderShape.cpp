@@ -20,24 +20,21 @@ CylinderShape::CylinderShape(Vector3 halfExtents)
 CylinderShape::CylinderShape(btScalar halfExtentsX, btScalar halfExtentsY, btScalar halfExtentsZ)
 	: ConvexInternalShape(0)
 {
-	btVector3* halfExtentsTemp = ALIGNED_NEW(btVector3) (halfExtentsX, halfExtentsY, halfExtentsZ);
+	ALIGNED_STACK(btVector3, halfExtentsTemp) (halfExtentsX, halfExtentsY, halfExtentsZ);
 	UnmanagedPointer = new btCylinderShape(*halfExtentsTemp);
-	ALIGNED_FREE(halfExtentsTemp);
 }
 
 CylinderShape::CylinderShape(btScalar halfExtents)
 	: ConvexInternalShape(0)
 {
-	btVector3* halfExtentsTemp = ALIGNED_NEW(btVector3) (halfExtents, halfExtents, halfExtents);
+	ALIGNED_STACK(btVector3, halfExtentsTemp) (halfExtents, halfExtents, halfExtents);
 	UnmanagedPointer = new btCylinderShape(*halfExtentsTemp);
-	ALIGNED_FREE(halfExtentsTemp);
 }
 
 Vector3 CylinderShape::HalfExtentsWithMargin::get()
 {
-	btVector3* extentsTemp = ALIGNED_NEW(btVector3) (Native->getHalfExtentsWithMargin());
+	ALIGNED_STACK(btVector3, extentsTemp) (Native->getHalfExtentsWithMargin());
 	Vector3 extents = Math::BtVector3ToVector3(extentsTemp);
-	ALIGNED_FREE(extentsTemp);
 	return extents;
 }
 
@@ -68,17 +65,15 @@ CylinderShapeX::CylinderShapeX(Vector3 halfExtents)
 CylinderShapeX::CylinderShapeX(btScalar halfExtentsX, btScalar halfExtentsY, btScalar halfExtentsZ)
 	: CylinderShape((btCylinderShape*)0)
 {
-	btVector3* halfExtentsTemp = ALIGNED_NEW(btVector3) (halfExtentsX, halfExtentsY, halfExtentsZ);
+	ALIGNED_STACK(btVector3, halfExtentsTemp) (halfExtentsX, halfExtentsY, halfExtentsZ);
 	UnmanagedPointer = new btCylinderShapeX(*halfExtentsTemp);
-	ALIGNED_FREE(halfExtentsTemp);
 }
 
 CylinderShapeX::CylinderShapeX(btScalar halfExtents)
 	: CylinderShape((btCylinderShape*)0)
 {
-	btVector3* halfExtentsTemp = ALIGNED_NEW(btVector3) (halfExtents, halfExtents, halfExtents);
+	ALIGNED_STACK(btVector3, halfExtentsTemp) (halfExtents, halfExtents, halfExtents);
 	UnmanagedPointer = new btCylinderShapeX(*halfExtentsTemp);
-	ALIGNED_FREE(halfExtentsTemp);
 }
 
 
@@ -93,15 +88,13 @@ CylinderShapeZ::CylinderShapeZ(Vector3 halfExtents)
 CylinderShapeZ::CylinderShapeZ(btScalar halfExtentsX, btScalar halfExtentsY, btScalar halfExtentsZ)
 : CylinderShape((btCylinderShape*)0)
 {
-	btVector3* halfExtentsTemp = ALIGNED_NEW(btVector3) (halfExtentsX, halfExtentsY, halfExtentsZ);
+	ALIGNED_STACK(btVector3, halfExtentsTemp) (halfExtentsX, halfExtentsY, halfExtentsZ);
 	UnmanagedPointer = new btCylinderShapeZ(*halfExtentsTemp);
-	ALIGNED_FREE(halfExtentsTemp);
 }
 
 CylinderShapeZ::CylinderShapeZ(btScalar halfExtents)
 	: CylinderShape((btCylinderShape*)0)
 {
-	btVector3* halfExtentsTemp = ALIGNED_NEW(btVector3) (halfExtents, halfExtents, halfExtents);
+	ALIGNED_STACK(btVector3, halfExtentsTemp) (halfExtents, halfExtents, halfExtents);
 	UnmanagedPointer = new btCylinderShapeZ(*halfExtentsTemp);
-	ALIGNED_FREE(halfExtentsTemp);
 }
\ No newline at end of file
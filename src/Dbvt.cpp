@@ -140,28 +140,25 @@ void DbvtAabbMm::SignedExpand(Vector3 e)
 
 Vector3 DbvtAabbMm::Center::get()
 {
-	btVector3* center = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, center);
 	DbvtAabbMm_Center(_native, center);
 	Vector3 v = Math::BtVector3ToVector3(center);
-	ALIGNED_FREE(center);
 	return v;
 }
 
 Vector3 DbvtAabbMm::Extents::get()
 {
-	btVector3* extents = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, extents);
 	DbvtAabbMm_Extents(_native, extents);
 	Vector3 v = Math::BtVector3ToVector3(extents);
-	ALIGNED_FREE(extents);
 	return v;
 }
 
 Vector3 DbvtAabbMm::Lengths::get()
 {
-	btVector3* lengths = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, lengths);
 	DbvtAabbMm_Lengths(_native, lengths);
 	Vector3 v = Math::BtVector3ToVector3(lengths);
-	ALIGNED_FREE(lengths);
 	return v;
 }
 
@@ -83,14 +83,14 @@ void DebugDraw::DrawBox(Vector3% bbMin, Vector3% bbMax, Matrix% trans, BtColor c
 {
 	VECTOR3_CONV(bbMin);
 	VECTOR3_CONV(bbMax);
-	btTransform* transTemp = Math::MatrixToBtTransform(trans);
+	ALIGNED_STACK(btTransform, transTemp);
+	Math::MatrixToBtTransform(trans, transTemp);
 	btVector3* colorTemp = BtColorToBtVector(color);
 
 	_native->baseDrawBox(VECTOR3_USE(bbMin), VECTOR3_USE(bbMax), *transTemp, *colorTemp);
 	
 	VECTOR3_DEL(bbMin);
 	VECTOR3_DEL(bbMax);
-	ALIGNED_FREE(transTemp);
 	delete colorTemp;
 };
 
@@ -109,34 +109,34 @@ void DebugDraw::DrawBox(Vector3% bbMin, Vector3% bbMax, BtColor color)
 
 void DebugDraw::DrawCapsule(btScalar radius, btScalar halfHeight, int upAxis, Matrix% transform, BtColor color)
 {
-	btTransform* transformTemp = Math::MatrixToBtTransform(transform);
+	ALIGNED_STACK(btTransform, transformTemp);
+	Math::MatrixToBtTransform(transform, transformTemp);
 	btVector3* colorTemp = BtColorToBtVector(color);
 
 	_native->baseDrawCapsule(radius, halfHeight, upAxis, *transformTemp, *colorTemp);
 
-	ALIGNED_FREE(transformTemp);
 	delete colorTemp;
 }
 
 void DebugDraw::DrawCone(btScalar radius, btScalar height, int upAxis, Matrix% transform, BtColor color)
 {
-	btTransform* transformTemp = Math::MatrixToBtTransform(transform);
+	ALIGNED_STACK(btTransform, transformTemp);
+	Math::MatrixToBtTransform(transform, transformTemp);
 	btVector3* colorTemp = BtColorToBtVector(color);
 
 	_native->baseDrawCone(radius, height, upAxis, *transformTemp, *colorTemp);
 
-	ALIGNED_FREE(transformTemp);
 	delete colorTemp;
 }
 
 void DebugDraw::DrawCylinder(btScalar radius, btScalar halfHeight, int upAxis, Matrix% transform, BtColor color)
 {
-	btTransform* transformTemp = Math::MatrixToBtTransform(transform);
+	ALIGNED_STACK(btTransform, transformTemp);
+	Math::MatrixToBtTransform(transform, transformTemp);
 	btVector3* colorTemp = BtColorToBtVector(color);
 
 	_native->baseDrawCylinder(radius, halfHeight, upAxis, *transformTemp, *colorTemp);
 
-	ALIGNED_FREE(transformTemp);
 	delete colorTemp;
 }
 
@@ -158,13 +158,13 @@ void DebugDraw::DrawLine(Vector3% from, Vector3% to, BtColor fromColor, BtColor
 void DebugDraw::DrawPlane(Vector3% planeNormal, btScalar planeConst, Matrix% transform, BtColor color)
 {
 	VECTOR3_CONV(planeNormal);
-	btTransform* transformTemp = Math::MatrixToBtTransform(transform);
+	ALIGNED_STACK(btTransform, transformTemp);
+	Math::MatrixToBtTransform(transform, transformTemp);
 	btVector3* colorTemp = BtColorToBtVector(color);
 
 	_native->baseDrawPlane(VECTOR3_USE(planeNormal), planeConst, *transformTemp, *colorTemp);
 
 	VECTOR3_DEL(planeNormal);
-	ALIGNED_FREE(transformTemp);
 	delete colorTemp;
 }
 
@@ -181,12 +181,12 @@ void DebugDraw::DrawSphere(Vector3% p, btScalar radius, BtColor color)
 
 void DebugDraw::DrawSphere(btScalar radius, Matrix% transform, BtColor color)
 {
-	btTransform* transformTemp = Math::MatrixToBtTransform(transform);
+	ALIGNED_STACK(btTransform, transformTemp);
+	Math::MatrixToBtTransform(transform, transformTemp);
 	btVector3* colorTemp = BtColorToBtVector(color);
 
 	_native->baseDrawSphere(radius, *transformTemp, *colorTemp);
 
-	ALIGNED_FREE(transformTemp);
 	delete colorTemp;
 }
 
@@ -240,9 +240,9 @@ void DebugDraw::DrawSpherePatch(Vector3% center, Vector3% up, Vector3% axis, btS
 
 void DebugDraw::DrawTransform(Matrix% transform, btScalar orthoLen)
 {
-	btTransform* transformTemp = Math::MatrixToBtTransform(transform);
+	ALIGNED_STACK(btTransform, transformTemp);
+	Math::MatrixToBtTransform(transform, transformTemp);
 	_native->baseDrawTransform(*transformTemp, orthoLen);
-	ALIGNED_FREE(transformTemp);
 }
 
 void DebugDraw::DrawTriangle(Vector3% v0, Vector3% v1, Vector3% v2, BtColor color, btScalar)
@@ -19,9 +19,9 @@ DefaultMotionState::DefaultMotionState(Matrix startTrans)
 {
 	TRANSFORM_CONV(startTrans);
 #ifdef BT_USE_SSE_IN_API
-	btTransform* centerOfMassOffset = Math::MatrixToBtTransform(Matrix_Identity); // default optional parameters are not aligned
+	ALIGNED_STACK(btTransform, centerOfMassOffset); // default optional parameters are not aligned
+	Math::MatrixToBtTransform(Matrix_Identity, centerOfMassOffset);
 	_native = ALIGNED_NEW(btDefaultMotionState) (TRANSFORM_USE(startTrans), *centerOfMassOffset);
-	ALIGNED_FREE(centerOfMassOffset);
 #else
 	_native = ALIGNED_NEW(btDefaultMotionState) (TRANSFORM_USE(startTrans));
 #endif
@@ -32,9 +32,9 @@ DefaultMotionState::DefaultMotionState()
 	: MotionState(0)
 {
 #ifdef BT_USE_SSE_IN_API
-	btTransform* identityMatrix = Math::MatrixToBtTransform(Matrix_Identity); // default optional parameters are not aligned
+	ALIGNED_STACK(btTransform, identityMatrix); // default optional parameters are not aligned
+	Math::MatrixToBtTransform(Matrix_Identity, identityMatrix);
 	_native = ALIGNED_NEW(btDefaultMotionState) (*identityMatrix, *identityMatrix);
-	ALIGNED_FREE(identityMatrix);
 #else
 	_native = ALIGNED_NEW(btDefaultMotionState) ();
 #endif
@@ -78,24 +78,22 @@ void DefaultMotionState::UserObject::set(Object^ value)
 
 Matrix DefaultMotionState::WorldTransform::get()
 {
-	btTransform* transform = ALIGNED_NEW(btTransform);
+	ALIGNED_STACK(btTransform, transform);
 	_native->getWorldTransform(*transform);
 	Matrix m = Math::BtTransformToMatrix(transform);
-	ALIGNED_FREE(transform);
 	return m;
 }
 void DefaultMotionState::WorldTransform::set(Matrix worldTransform)
 {
-	btTransform* worldTransformTemp = Math::MatrixToBtTransform(worldTransform);
+	ALIGNED_STACK(btTransform, worldTransformTemp);
+	Math::MatrixToBtTransform(worldTransform, worldTransformTemp);
 	_native->setWorldTransform(*worldTransformTemp);
-	ALIGNED_FREE(worldTransformTemp);
 }
 
 
 void DefaultMotionState::GetWorldTransform([Out] Matrix% outTransform)
 {
-	btTransform* transform = ALIGNED_NEW(btTransform);
+	ALIGNED_STACK(btTransform, transform);
 	_native->getWorldTransform(*transform);
 	Math::BtTransformToMatrix(transform, outTransform);
-	ALIGNED_FREE(transform);
 }
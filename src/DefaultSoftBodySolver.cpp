@@ -2,14 +2,19 @@
 
 #ifndef DISABLE_SOFTBODY
 
+#include "Collections.h"
 #include "DefaultSoftBodySolver.h"
 #include "SoftBody.h"
 #include "SoftBodySolverVertexBuffer.h"
 
-#define Native static_cast<btDefaultSoftBodySolver*>(_native)
+#pragma managed(push, off)
+#include <BulletSoftBody/btSoftBodyInternals.h>
+#pragma managed(pop)
+
+#define Native static_cast<DefaultSoftBodySolverWrapper*>(_native)
 
 SoftBody::DefaultSoftBodySolver::DefaultSoftBodySolver()
-	: SoftBodySolver(new btDefaultSoftBodySolver())
+	: SoftBodySolver(new DefaultSoftBodySolverWrapper())
 {
 }
 
@@ -18,4 +23,1375 @@ void SoftBody::DefaultSoftBodySolver::CopySoftBodyToVertexBuffer(SoftBody^ softB
 	Native->copySoftBodyToVertexBuffer((btSoftBody*)softBody->_native, vertexBuffer->_native);
 }
 
+#pragma managed(push, off)
+unsigned short DefaultSoftBodySolver_FloatToHalf(float value)
+{
+	union
+	{
+		float f;
+		unsigned int u;
+	} bits;
+	bits.f = value;
+
+	unsigned int sign = (bits.u >> 16) & 0x8000;
+	int exponent = (int)((bits.u >> 23) & 0xff) - 127 + 15;
+	unsigned int mantissa = bits.u & 0x7fffff;
+	if (exponent <= 0)
+	{
+		// Too small for a normalized half
+		return (unsigned short)sign;
+	}
+	if (exponent >= 31)
+	{
+		bool isNaN = ((bits.u >> 23) & 0xff) == 0xff && mantissa != 0;
+		return (unsigned short)(sign | 0x7c00 | (isNaN ? 0x200 : 0));
+	}
+
+	// Round to nearest, a carry into the exponent is still correct
+	unsigned int half = sign | (exponent << 10) | (mantissa >> 13);
+	if (mantissa & 0x1000)
+	{
+		half++;
+	}
+	return (unsigned short)half;
+}
+
+void DefaultSoftBodySolver_CopySoftBodiesToVertexBuffer(btSoftBody** softBodies, const int* baseVertices, int numBodies,
+	btCPUVertexBufferDescriptor* vertexBuffer, bool halfPrecisionNormals)
+{
+	float* basePointer = vertexBuffer->getBasePointer();
+	const int vertexStride = vertexBuffer->getVertexStride();
+	const int normalStride = vertexBuffer->getNormalStride();
+
+	for (int i = 0; i < numBodies; i++)
+	{
+		const btAlignedObjectArray<btSoftBody::Node>& nodes = softBodies[i]->m_nodes;
+		int numNodes = nodes.size();
+
+		if (vertexBuffer->hasVertexPositions())
+		{
+			float* vertexPointer = basePointer + vertexBuffer->getVertexOffset() + baseVertices[i] * vertexStride;
+			for (int j = 0; j < numNodes; j++)
+			{
+				const btVector3& position = nodes[j].m_x;
+				vertexPointer[0] = (float)position.getX();
+				vertexPointer[1] = (float)position.getY();
+				vertexPointer[2] = (float)position.getZ();
+				vertexPointer += vertexStride;
+			}
+		}
+
+		if (vertexBuffer->hasNormals())
+		{
+			float* normalPointer = basePointer + vertexBuffer->getNormalOffset() + baseVertices[i] * normalStride;
+			for (int j = 0; j < numNodes; j++)
+			{
+				const btVector3& normal = nodes[j].m_n;
+				if (halfPrecisionNormals)
+				{
+					unsigned short* halfPointer = (unsigned short*)normalPointer;
+					halfPointer[0] = DefaultSoftBodySolver_FloatToHalf((float)normal.getX());
+					halfPointer[1] = DefaultSoftBodySolver_FloatToHalf((float)normal.getY());
+					halfPointer[2] = DefaultSoftBodySolver_FloatToHalf((float)normal.getZ());
+					halfPointer[3] = 0;
+				}
+				else
+				{
+					normalPointer[0] = (float)normal.getX();
+					normalPointer[1] = (float)normal.getY();
+					normalPointer[2] = (float)normal.getZ();
+				}
+				normalPointer += normalStride;
+			}
+		}
+	}
+}
+#pragma managed(pop)
+
+void SoftBody::DefaultSoftBodySolver::CopySoftBodiesToVertexBuffer(array<SoftBody^>^ softBodies, array<int>^ baseVertices,
+	VertexBufferDescriptor^ vertexBuffer, bool halfPrecisionNormals)
+{
+	if (softBodies == nullptr)
+		throw gcnew ArgumentNullException("softBodies");
+	if (baseVertices == nullptr)
+		throw gcnew ArgumentNullException("baseVertices");
+	if (vertexBuffer == nullptr)
+		throw gcnew ArgumentNullException("vertexBuffer");
+	if (baseVertices->Length != softBodies->Length)
+		throw gcnew ArgumentException("There must be one base vertex per soft body.", "baseVertices");
+	if (vertexBuffer->_native->getBufferType() != btVertexBufferDescriptor::CPU_BUFFER)
+		throw gcnew ArgumentException("Only CPU vertex buffers are supported.", "vertexBuffer");
+
+	int numBodies = softBodies->Length;
+	if (numBodies == 0)
+		return;
+
+	// Check everything before writing, the native copy doesn't know the size of the buffer
+	btVertexBufferDescriptor* descriptor = vertexBuffer->_native;
+	CpuVertexBufferDescriptor^ cpuBuffer = dynamic_cast<CpuVertexBufferDescriptor^>(vertexBuffer);
+	FloatArray^ floatArray = cpuBuffer != nullptr ? cpuBuffer->VertexBuffer : nullptr;
+	for (int i = 0; i < numBodies; i++)
+	{
+		if (softBodies[i] == nullptr)
+			throw gcnew ArgumentNullException("softBodies");
+		if (baseVertices[i] < 0)
+			throw gcnew ArgumentOutOfRangeException("baseVertices");
+
+		int numNodes = ((btSoftBody*)softBodies[i]->_native)->m_nodes.size();
+		if (floatArray == nullptr || numNodes == 0)
+			continue;
+
+		Int64 lastVertex = (Int64)baseVertices[i] + numNodes - 1;
+		if (descriptor->hasVertexPositions() &&
+			descriptor->getVertexOffset() + lastVertex * descriptor->getVertexStride() + 3 > floatArray->Count)
+		{
+			throw gcnew ArgumentException("The vertex buffer is too small.", "baseVertices");
+		}
+		if (descriptor->hasNormals() &&
+			descriptor->getNormalOffset() + lastVertex * descriptor->getNormalStride() + (halfPrecisionNormals ? 2 : 3) > floatArray->Count)
+		{
+			throw gcnew ArgumentException("The vertex buffer is too small.", "baseVertices");
+		}
+	}
+
+	btSoftBody** softBodiesTemp = new btSoftBody*[numBodies];
+	for (int i = 0; i < numBodies; i++)
+	{
+		softBodiesTemp[i] = (btSoftBody*)softBodies[i]->_native;
+	}
+
+	pin_ptr<int> baseVerticesPtr = &baseVertices[0];
+	DefaultSoftBodySolver_CopySoftBodiesToVertexBuffer(softBodiesTemp, baseVerticesPtr, numBodies,
+		static_cast<btCPUVertexBufferDescriptor*>(vertexBuffer->_native), halfPrecisionNormals);
+
+	delete[] softBodiesTemp;
+}
+
+void SoftBody::DefaultSoftBodySolver::CopySoftBodiesToVertexBuffer(array<SoftBody^>^ softBodies, array<int>^ baseVertices,
+	VertexBufferDescriptor^ vertexBuffer)
+{
+	CopySoftBodiesToVertexBuffer(softBodies, baseVertices, vertexBuffer, false);
+}
+
+int SoftBody::DefaultSoftBodySolver::NumThreads::get()
+{
+	return Native->_numThreads;
+}
+void SoftBody::DefaultSoftBodySolver::NumThreads::set(int value)
+{
+	if (value < 1)
+		throw gcnew ArgumentOutOfRangeException("value");
+
+	Native->_numThreads = value;
+}
+
+bool SoftBody::DefaultSoftBodySolver::UseBatchedLinkSolver::get()
+{
+	return Native->_batchedLinks;
+}
+void SoftBody::DefaultSoftBodySolver::UseBatchedLinkSolver::set(bool value)
+{
+	Native->_batchedLinks = value;
+}
+
+int SoftBody::DefaultSoftBodySolver::ParallelLinkThreshold::get()
+{
+	return Native->_parallelLinkThreshold;
+}
+void SoftBody::DefaultSoftBodySolver::ParallelLinkThreshold::set(int value)
+{
+	if (value < 0)
+		throw gcnew ArgumentOutOfRangeException("value");
+	Native->_parallelLinkThreshold = value;
+}
+
+btScalar SoftBody::DefaultSoftBodySolver::SleepingThreshold::get()
+{
+	return Native->_sleepingThreshold;
+}
+void SoftBody::DefaultSoftBodySolver::SleepingThreshold::set(btScalar value)
+{
+	if (value < 0)
+		throw gcnew ArgumentOutOfRangeException("value");
+	Native->_sleepingThreshold = value;
+}
+
+btScalar SoftBody::DefaultSoftBodySolver::LodDistance::get()
+{
+	return Native->_lodDistance;
+}
+void SoftBody::DefaultSoftBodySolver::LodDistance::set(btScalar value)
+{
+	if (value < 0)
+		throw gcnew ArgumentOutOfRangeException("value");
+	Native->_lodDistance = value;
+}
+
+Vector3 SoftBody::DefaultSoftBodySolver::LodViewerPosition::get()
+{
+	return Math::BtVector3ToVector3(&Native->_lodViewerPosition);
+}
+void SoftBody::DefaultSoftBodySolver::LodViewerPosition::set(Vector3 value)
+{
+	Math::Vector3ToBtVector3(value, &Native->_lodViewerPosition);
+}
+
+// The state is keyed by the native body, which can be freed and its address reused after the removal
+void SoftBody::DefaultSoftBodySolver::OnSoftBodyRemoved(SoftBody^ softBody)
+{
+	Native->removeLodState((btSoftBody*)softBody->_native);
+}
+
+bool SoftBody::DefaultSoftBodySolver::IsReducedLod(SoftBody^ softBody)
+{
+	if (softBody == nullptr)
+		throw gcnew ArgumentNullException("softBody");
+	return Native->findLodState((btSoftBody*)softBody->_native) != 0;
+}
+
+
+#pragma managed(push, off)
+enum SoftBodySolverPass
+{
+	SoftBodySolverPass_PredictMotion,
+	SoftBodySolverPass_SolveConstraints,
+	SoftBodySolverPass_SolveConstraintsCustomLinks,
+	SoftBodySolverPass_IntegrateMotion
+};
+
+// Splits the links into runs of at most four consecutive links without shared nodes.
+// Links within a run can be solved at once with the same result as solving them in order.
+void DefaultSoftBodySolver_BuildLinkBatches(const btSoftBody* psb, btAlignedObjectArray<int>& batchStarts)
+{
+	const btAlignedObjectArray<btSoftBody::Link>& links = psb->m_links;
+	int numLinks = links.size();
+	batchStarts.resize(0);
+	if (numLinks == 0)
+		return;
+
+	btAlignedObjectArray<int> nodeBatches;
+	nodeBatches.resize(psb->m_nodes.size(), -1);
+	const btSoftBody::Node* nodes = &psb->m_nodes[0];
+	int batch = -1;
+	int batchSize = 4;
+	for (int i = 0; i < numLinks; i++)
+	{
+		int node0 = (int)(links[i].m_n[0] - nodes);
+		int node1 = (int)(links[i].m_n[1] - nodes);
+		if (batchSize == 4 || nodeBatches[node0] == batch || nodeBatches[node1] == batch)
+		{
+			batch++;
+			batchSize = 0;
+			batchStarts.push_back(i);
+		}
+		nodeBatches[node0] = batch;
+		nodeBatches[node1] = batch;
+		batchSize++;
+	}
+	batchStarts.push_back(numLinks);
+}
+
+// Same as btSoftBody::PSolve_Links for a single link
+inline void DefaultSoftBodySolver_PSolveLink(btSoftBody::Link& l, btScalar kst)
+{
+	if (l.m_c0 > 0)
+	{
+		btSoftBody::Node& a = *l.m_n[0];
+		btSoftBody::Node& b = *l.m_n[1];
+		const btVector3 del = b.m_x - a.m_x;
+		const btScalar len = del.length2();
+		if (l.m_c1 + len > SIMD_EPSILON)
+		{
+			const btScalar k = ((l.m_c1 - len) / (l.m_c0 * (l.m_c1 + len))) * kst;
+			a.m_x -= del * (k * a.m_im);
+			b.m_x += del * (k * b.m_im);
+		}
+	}
+}
+
+#if defined(BT_USE_SSE) && !defined(BT_USE_DOUBLE_PRECISION)
+// Solves four links that share no nodes
+void DefaultSoftBodySolver_PSolveLinks4(btSoftBody::Link* const* links, btScalar kst)
+{
+	ATTRIBUTE_ALIGNED16(float ax[4]);
+	ATTRIBUTE_ALIGNED16(float ay[4]);
+	ATTRIBUTE_ALIGNED16(float az[4]);
+	ATTRIBUTE_ALIGNED16(float bx[4]);
+	ATTRIBUTE_ALIGNED16(float by[4]);
+	ATTRIBUTE_ALIGNED16(float bz[4]);
+	ATTRIBUTE_ALIGNED16(float c0[4]);
+	ATTRIBUTE_ALIGNED16(float c1[4]);
+	ATTRIBUTE_ALIGNED16(float ima[4]);
+	ATTRIBUTE_ALIGNED16(float imb[4]);
+
+	for (int i = 0; i < 4; i++)
+	{
+		const btSoftBody::Node* a = links[i]->m_n[0];
+		const btSoftBody::Node* b = links[i]->m_n[1];
+		ax[i] = a->m_x.getX();
+		ay[i] = a->m_x.getY();
+		az[i] = a->m_x.getZ();
+		bx[i] = b->m_x.getX();
+		by[i] = b->m_x.getY();
+		bz[i] = b->m_x.getZ();
+		c0[i] = links[i]->m_c0;
+		c1[i] = links[i]->m_c1;
+		ima[i] = a->m_im;
+		imb[i] = b->m_im;
+	}
+
+	__m128 axv = _mm_load_ps(ax);
+	__m128 ayv = _mm_load_ps(ay);
+	__m128 azv = _mm_load_ps(az);
+	__m128 bxv = _mm_load_ps(bx);
+	__m128 byv = _mm_load_ps(by);
+	__m128 bzv = _mm_load_ps(bz);
+	__m128 c0v = _mm_load_ps(c0);
+	__m128 c1v = _mm_load_ps(c1);
+
+	__m128 dx = _mm_sub_ps(bxv, axv);
+	__m128 dy = _mm_sub_ps(byv, ayv);
+	__m128 dz = _mm_sub_ps(bzv, azv);
+	__m128 len = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+	__m128 sum = _mm_add_ps(c1v, len);
+
+	// Lanes that the scalar solver would skip get k = 0
+	__m128 valid = _mm_and_ps(_mm_cmpgt_ps(c0v, _mm_setzero_ps()), _mm_cmpgt_ps(sum, _mm_set1_ps(SIMD_EPSILON)));
+	__m128 k = _mm_mul_ps(_mm_div_ps(_mm_sub_ps(c1v, len), _mm_mul_ps(c0v, sum)), _mm_set1_ps(kst));
+	k = _mm_and_ps(k, valid);
+
+	__m128 ka = _mm_mul_ps(k, _mm_load_ps(ima));
+	__m128 kb = _mm_mul_ps(k, _mm_load_ps(imb));
+	_mm_store_ps(ax, _mm_sub_ps(axv, _mm_mul_ps(dx, ka)));
+	_mm_store_ps(ay, _mm_sub_ps(ayv, _mm_mul_ps(dy, ka)));
+	_mm_store_ps(az, _mm_sub_ps(azv, _mm_mul_ps(dz, ka)));
+	_mm_store_ps(bx, _mm_add_ps(bxv, _mm_mul_ps(dx, kb)));
+	_mm_store_ps(by, _mm_add_ps(byv, _mm_mul_ps(dy, kb)));
+	_mm_store_ps(bz, _mm_add_ps(bzv, _mm_mul_ps(dz, kb)));
+
+	for (int i = 0; i < 4; i++)
+	{
+		links[i]->m_n[0]->m_x.setValue(ax[i], ay[i], az[i]);
+		links[i]->m_n[1]->m_x.setValue(bx[i], by[i], bz[i]);
+	}
+}
+#endif
+
+void DefaultSoftBodySolver_PSolveLinks(btSoftBody* psb, const btAlignedObjectArray<int>& batchStarts, btScalar kst)
+{
+	btSoftBody::Link* links = psb->m_links.size() ? &psb->m_links[0] : 0;
+	for (int batch = 0; batch + 1 < batchStarts.size(); batch++)
+	{
+		int start = batchStarts[batch];
+		int end = batchStarts[batch + 1];
+#if defined(BT_USE_SSE) && !defined(BT_USE_DOUBLE_PRECISION)
+		if (end - start == 4)
+		{
+			btSoftBody::Link* batchLinks[4] = { &links[start], &links[start + 1], &links[start + 2], &links[start + 3] };
+			DefaultSoftBodySolver_PSolveLinks4(batchLinks, kst);
+			continue;
+		}
+#endif
+		for (int i = start; i < end; i++)
+		{
+			DefaultSoftBodySolver_PSolveLink(links[i], kst);
+		}
+	}
+}
+
+// Sorts the links by color so that links of the same color share no nodes.
+// Each link gets the lowest color not used by its nodes, links keep their order within a color.
+// Returns false if the nodes have too many links for the color masks.
+bool DefaultSoftBodySolver_ColorLinks(const btSoftBody* psb, btAlignedObjectArray<int>& coloredLinks,
+	btAlignedObjectArray<int>& colorStarts)
+{
+	const int maxColors = 32;
+	const btAlignedObjectArray<btSoftBody::Link>& links = psb->m_links;
+	int numLinks = links.size();
+
+	btAlignedObjectArray<unsigned int> nodeColors;
+	nodeColors.resize(psb->m_nodes.size(), 0);
+	btAlignedObjectArray<int> linkColors;
+	linkColors.resize(numLinks);
+	const btSoftBody::Node* nodes = &psb->m_nodes[0];
+	int numColors = 0;
+	for (int i = 0; i < numLinks; i++)
+	{
+		int node0 = (int)(links[i].m_n[0] - nodes);
+		int node1 = (int)(links[i].m_n[1] - nodes);
+		unsigned int used = nodeColors[node0] | nodeColors[node1];
+		int color = 0;
+		while (color < maxColors && (used & (1u << color)))
+		{
+			color++;
+		}
+		if (color == maxColors)
+			return false;
+
+		nodeColors[node0] |= 1u << color;
+		nodeColors[node1] |= 1u << color;
+		linkColors[i] = color;
+		numColors = btMax(numColors, color + 1);
+	}
+
+	// Counting sort by color
+	colorStarts.resize(0);
+	colorStarts.resize(numColors + 1, 0);
+	for (int i = 0; i < numLinks; i++)
+	{
+		colorStarts[linkColors[i] + 1]++;
+	}
+	for (int i = 0; i < numColors; i++)
+	{
+		colorStarts[i + 1] += colorStarts[i];
+	}
+	btAlignedObjectArray<int> next;
+	next.resize(numColors);
+	for (int i = 0; i < numColors; i++)
+	{
+		next[i] = colorStarts[i];
+	}
+	coloredLinks.resize(numLinks);
+	for (int i = 0; i < numLinks; i++)
+	{
+		coloredLinks[next[linkColors[i]]++] = i;
+	}
+	return true;
+}
+
+// Solves coloredLinks[start, end), which all have the same color
+void DefaultSoftBodySolver_PSolveColoredLinks(btSoftBody* psb, const int* coloredLinks, int start, int end,
+	btScalar kst, bool batched)
+{
+	btSoftBody::Link* links = &psb->m_links[0];
+#if defined(BT_USE_SSE) && !defined(BT_USE_DOUBLE_PRECISION)
+	if (batched)
+	{
+		for (; start + 4 <= end; start += 4)
+		{
+			btSoftBody::Link* batchLinks[4] = { &links[coloredLinks[start]], &links[coloredLinks[start + 1]],
+				&links[coloredLinks[start + 2]], &links[coloredLinks[start + 3]] };
+			DefaultSoftBodySolver_PSolveLinks4(batchLinks, kst);
+		}
+	}
+#endif
+	for (int i = start; i < end; i++)
+	{
+		DefaultSoftBodySolver_PSolveLink(links[coloredLinks[i]], kst);
+	}
+}
+
+// Follows btSoftBody::solveConstraints, but runs the linear position solver in link batches
+// or in graph-colored link batches across the solver's threads
+void DefaultSoftBodySolver_SolveConstraints(btSoftBody* psb, const SoftBody::DefaultSoftBodySolverWrapper* solver)
+{
+	int i, ni;
+
+	/* Apply clusters */
+	psb->applyClusters(false);
+
+	/* Prepare links */
+	for (i = 0, ni = psb->m_links.size(); i < ni; ++i)
+	{
+		btSoftBody::Link& l = psb->m_links[i];
+		l.m_c3 = l.m_n[1]->m_q - l.m_n[0]->m_q;
+		l.m_c2 = 1 / (l.m_c3.length2() * l.m_c0);
+	}
+
+	/* Prepare anchors */
+	for (i = 0, ni = psb->m_anchors.size(); i < ni; ++i)
+	{
+		btSoftBody::Anchor& a = psb->m_anchors[i];
+		const btVector3 ra = a.m_body->getWorldTransform().getBasis() * a.m_local;
+		a.m_c0 = ImpulseMatrix(psb->m_sst.sdt, a.m_node->m_im, a.m_body->getInvMass(),
+			a.m_body->getInvInertiaTensorWorld(), ra);
+		a.m_c1 = ra;
+		a.m_c2 = psb->m_sst.sdt * a.m_node->m_im;
+		a.m_body->activate();
+	}
+
+	/* Solve velocities */
+	if (psb->m_cfg.viterations > 0)
+	{
+		for (int isolve = 0; isolve < psb->m_cfg.viterations; ++isolve)
+		{
+			for (int iseq = 0; iseq < psb->m_cfg.m_vsequence.size(); ++iseq)
+			{
+				btSoftBody::getSolver(psb->m_cfg.m_vsequence[iseq])(psb, 1);
+			}
+		}
+		for (i = 0, ni = psb->m_nodes.size(); i < ni; ++i)
+		{
+			btSoftBody::Node& n = psb->m_nodes[i];
+			n.m_x = n.m_q + n.m_v * psb->m_sst.sdt;
+		}
+	}
+
+	/* Solve positions */
+	if (psb->m_cfg.piterations > 0)
+	{
+		btAlignedObjectArray<int> batchStarts;
+		btAlignedObjectArray<int> coloredLinks;
+		btAlignedObjectArray<int> colorStarts;
+		bool colored = solver->_parallelLinkThreshold > 0 && psb->m_links.size() >= solver->_parallelLinkThreshold &&
+			DefaultSoftBodySolver_ColorLinks(psb, coloredLinks, colorStarts);
+		if (!colored && solver->_batchedLinks)
+		{
+			DefaultSoftBodySolver_BuildLinkBatches(psb, batchStarts);
+		}
+
+		for (int isolve = 0; isolve < psb->m_cfg.piterations; ++isolve)
+		{
+			const btScalar ti = isolve / (btScalar)psb->m_cfg.piterations;
+			for (int iseq = 0; iseq < psb->m_cfg.m_psequence.size(); ++iseq)
+			{
+				btSoftBody::ePSolver::_ psolver = psb->m_cfg.m_psequence[iseq];
+				if (psolver == btSoftBody::ePSolver::Linear && colored)
+				{
+					solver->solveColoredLinks(psb, &coloredLinks[0], &colorStarts[0], colorStarts.size() - 1, 1);
+				}
+				else if (psolver == btSoftBody::ePSolver::Linear && solver->_batchedLinks)
+				{
+					DefaultSoftBodySolver_PSolveLinks(psb, batchStarts, 1);
+				}
+				else
+				{
+					btSoftBody::getSolver(psolver)(psb, 1, ti);
+				}
+			}
+		}
+		const btScalar vc = psb->m_sst.isdt * (1 - psb->m_cfg.kDP);
+		for (i = 0, ni = psb->m_nodes.size(); i < ni; ++i)
+		{
+			btSoftBody::Node& n = psb->m_nodes[i];
+			n.m_v = (n.m_x - n.m_q) * vc;
+			n.m_f = btVector3(0, 0, 0);
+		}
+	}
+
+	/* Solve drift */
+	if (psb->m_cfg.diterations > 0)
+	{
+		const btScalar vcf = psb->m_cfg.kVCF * psb->m_sst.isdt;
+		for (i = 0, ni = psb->m_nodes.size(); i < ni; ++i)
+		{
+			btSoftBody::Node& n = psb->m_nodes[i];
+			n.m_q = n.m_x;
+		}
+		for (int idrift = 0; idrift < psb->m_cfg.diterations; ++idrift)
+		{
+			for (int iseq = 0; iseq < psb->m_cfg.m_dsequence.size(); ++iseq)
+			{
+				btSoftBody::getSolver(psb->m_cfg.m_dsequence[iseq])(psb, 1, 0);
+			}
+		}
+		for (i = 0, ni = psb->m_nodes.size(); i < ni; ++i)
+		{
+			btSoftBody::Node& n = psb->m_nodes[i];
+			n.m_v += (n.m_x - n.m_q) * vcf;
+		}
+	}
+
+	/* Apply clusters */
+	psb->dampClusters();
+	psb->applyClusters(true);
+}
+
+// Coarse proxy of a body in the reduced LOD tier
+struct SoftBody::DefaultSoftBodySolverWrapper::LodState
+{
+	btSoftBody* body;
+	// One node per cluster, linked where the clusters are linked
+	btSoftBody* proxy;
+	// Proxy node that each node follows, -1 for nodes that stay in place
+	btAlignedObjectArray<int> proxyNodes;
+	// Offset of each node from its proxy node
+	btAlignedObjectArray<btVector3> offsets;
+
+	~LodState()
+	{
+		delete proxy;
+	}
+};
+
+btSoftBody* DefaultSoftBodySolver_FindFaceOwner(const btAlignedObjectArray<btSoftBody*>& bodies, const btSoftBody::Face* face)
+{
+	for (int i = 0; i < bodies.size(); i++)
+	{
+		const btAlignedObjectArray<btSoftBody::Face>& faces = bodies[i]->m_faces;
+		if (faces.size() != 0 && face >= &faces[0] && face < &faces[0] + faces.size())
+			return bodies[i];
+	}
+	return 0;
+}
+
+// True if the object is active and moves faster than its sleeping thresholds.
+// Anchors activate their rigid bodies while solving, so a resting anchored body is still active.
+bool DefaultSoftBodySolver_IsMoving(const btCollisionObject* colObj)
+{
+	if (!colObj->isActive() || colObj->isStaticObject())
+		return false;
+	const btRigidBody* body = btRigidBody::upcast(colObj);
+	if (body == 0)
+		return true;
+	const btScalar linearThreshold = body->getLinearSleepingThreshold();
+	const btScalar angularThreshold = body->getAngularSleepingThreshold();
+	return body->getLinearVelocity().length2() > linearThreshold * linearThreshold ||
+		body->getAngularVelocity().length2() > angularThreshold * angularThreshold;
+}
+
+// True if the body touches a moving body or is anchored to one
+bool DefaultSoftBodySolver_IsDisturbed(const btSoftBody* psb)
+{
+	if (psb->m_scontacts.size() != 0)
+		return true;
+	for (int i = 0; i < psb->m_rcontacts.size(); i++)
+	{
+		if (DefaultSoftBodySolver_IsMoving(psb->m_rcontacts[i].m_cti.m_colObj))
+			return true;
+	}
+	for (int i = 0; i < psb->m_anchors.size(); i++)
+	{
+		if (DefaultSoftBodySolver_IsMoving(psb->m_anchors[i].m_body))
+			return true;
+	}
+	return false;
+}
+
+// Pinned bodies without anchors can be reduced, the proxy has no collisions to hold up free bodies.
+bool DefaultSoftBodySolver_CanReduce(const btSoftBody* psb)
+{
+	if (psb->m_clusters.size() == 0 || psb->m_anchors.size() != 0)
+		return false;
+	for (int i = 0; i < psb->m_nodes.size(); i++)
+	{
+		if (psb->m_nodes[i].m_im == 0)
+			return true;
+	}
+	return false;
+}
+
+SoftBody::DefaultSoftBodySolverWrapper::LodState* DefaultSoftBodySolver_CreateLodState(btSoftBody* psb)
+{
+	int numNodes = psb->m_nodes.size();
+	int numClusters = psb->m_clusters.size();
+	const btSoftBody::Node* nodes = &psb->m_nodes[0];
+
+	SoftBody::DefaultSoftBodySolverWrapper::LodState* state = new SoftBody::DefaultSoftBodySolverWrapper::LodState();
+	state->body = psb;
+	state->proxyNodes.resize(numNodes, -1);
+	state->offsets.resize(numNodes, btVector3(0, 0, 0));
+
+	// Proxy nodes are at the center of mass of their cluster, or at the pinned nodes of pinned clusters.
+	// Clusters can share nodes, each node follows the first cluster that contains it.
+	btAlignedObjectArray<btVector3> positions;
+	positions.resize(numClusters, btVector3(0, 0, 0));
+	btAlignedObjectArray<btVector3> pinnedPositions;
+	pinnedPositions.resize(numClusters, btVector3(0, 0, 0));
+	btAlignedObjectArray<btVector3> momenta;
+	momenta.resize(numClusters, btVector3(0, 0, 0));
+	btAlignedObjectArray<btScalar> masses;
+	masses.resize(numClusters, 0);
+	btAlignedObjectArray<int> numPinned;
+	numPinned.resize(numClusters, 0);
+	for (int c = 0; c < numClusters; c++)
+	{
+		const btSoftBody::Cluster* cluster = psb->m_clusters[c];
+		for (int j = 0; j < cluster->m_nodes.size(); j++)
+		{
+			int n = (int)(cluster->m_nodes[j] - nodes);
+			if (state->proxyNodes[n] != -1)
+				continue;
+			state->proxyNodes[n] = c;
+
+			const btSoftBody::Node& node = nodes[n];
+			if (node.m_im > 0)
+			{
+				btScalar mass = 1 / node.m_im;
+				masses[c] += mass;
+				positions[c] += node.m_x * mass;
+				momenta[c] += node.m_v * mass;
+			}
+			else
+			{
+				pinnedPositions[c] += node.m_x;
+				numPinned[c]++;
+			}
+		}
+	}
+
+	btAlignedObjectArray<btVector3> velocities;
+	velocities.resize(numClusters, btVector3(0, 0, 0));
+	for (int c = 0; c < numClusters; c++)
+	{
+		if (numPinned[c] != 0)
+		{
+			// Mass 0 pins the proxy node
+			positions[c] = pinnedPositions[c] / (btScalar)numPinned[c];
+			masses[c] = 0;
+		}
+		else if (masses[c] > 0)
+		{
+			positions[c] /= masses[c];
+			velocities[c] = momenta[c] / masses[c];
+		}
+	}
+
+	btSoftBody* proxy = new btSoftBody(psb->getWorldInfo(), numClusters, &positions[0], &masses[0]);
+	proxy->m_cfg = psb->m_cfg;
+	proxy->m_cfg.kMT = 0;
+	proxy->m_cfg.kPR = 0;
+	proxy->m_cfg.kVC = 0;
+	proxy->m_materials[0]->m_kLST = psb->m_materials[0]->m_kLST;
+	for (int c = 0; c < numClusters; c++)
+	{
+		proxy->m_nodes[c].m_v = velocities[c];
+	}
+
+	btHashMap<btHashInt, int> proxyLinks;
+	for (int i = 0; i < psb->m_links.size(); i++)
+	{
+		const btSoftBody::Link& link = psb->m_links[i];
+		int c0 = state->proxyNodes[(int)(link.m_n[0] - nodes)];
+		int c1 = state->proxyNodes[(int)(link.m_n[1] - nodes)];
+		if (c0 == -1 || c1 == -1 || c0 == c1)
+			continue;
+		btHashInt key(btMin(c0, c1) * numClusters + btMax(c0, c1));
+		if (proxyLinks.find(key))
+			continue;
+		proxyLinks.insert(key, i);
+		proxy->appendLink(c0, c1);
+	}
+	state->proxy = proxy;
+
+	for (int n = 0; n < numNodes; n++)
+	{
+		int c = state->proxyNodes[n];
+		if (c == -1)
+			continue;
+		if (nodes[n].m_im == 0)
+		{
+			state->proxyNodes[n] = -1;
+			continue;
+		}
+		state->offsets[n] = nodes[n].m_x - proxy->m_nodes[c].m_x;
+	}
+	return state;
+}
+
+// Simulates the proxy and moves the nodes with it. Replaces predictMotion, solveConstraints and integrateMotion.
+void DefaultSoftBodySolver_StepLodState(SoftBody::DefaultSoftBodySolverWrapper::LodState* state, float solverdt)
+{
+	btSoftBody* psb = state->body;
+	btSoftBody* proxy = state->proxy;
+
+	// Contacts were checked when choosing the tier
+	psb->m_rcontacts.resize(0);
+	psb->m_scontacts.resize(0);
+
+	proxy->predictMotion(solverdt);
+	proxy->solveConstraints();
+	proxy->integrateMotion();
+
+	const btScalar margin = psb->getCollisionShape()->getMargin();
+	for (int i = 0; i < psb->m_nodes.size(); i++)
+	{
+		int c = state->proxyNodes[i];
+		if (c == -1)
+			continue;
+		btSoftBody::Node& n = psb->m_nodes[i];
+		const btSoftBody::Node& proxyNode = proxy->m_nodes[c];
+		n.m_q = n.m_x;
+		n.m_x = proxyNode.m_x + state->offsets[i];
+		n.m_v = proxyNode.m_v;
+		n.m_f = btVector3(0, 0, 0);
+		btDbvtVolume vol = btDbvtVolume::FromCR(n.m_x, margin);
+		psb->m_ndbvt.update(n.m_leaf, vol);
+	}
+	if (!psb->m_fdbvt.empty())
+	{
+		for (int i = 0; i < psb->m_faces.size(); i++)
+		{
+			btSoftBody::Face& f = psb->m_faces[i];
+			btDbvtVolume vol = VolumeOf(f, margin);
+			psb->m_fdbvt.update(f.m_leaf, vol);
+		}
+	}
+	psb->m_ndbvt.optimizeIncremental(1);
+	psb->m_fdbvt.optimizeIncremental(1);
+
+	psb->updateNormals();
+	psb->updateClusters();
+	psb->updateBounds();
+}
+
+// Puts the body to sleep once the mass-weighted mean of the squared node speeds
+// has stayed below threshold^2 for gDeactivationTime
+void DefaultSoftBodySolver_UpdateDeactivation(btSoftBody* psb, btScalar threshold, btScalar timeStep)
+{
+	if (!psb->isActive() || psb->getActivationState() == DISABLE_DEACTIVATION)
+		return;
+
+	btScalar energy = 0;
+	btScalar mass = 0;
+	for (int i = 0; i < psb->m_nodes.size(); i++)
+	{
+		const btSoftBody::Node& n = psb->m_nodes[i];
+		if (n.m_im > 0)
+		{
+			energy += n.m_v.length2() / n.m_im;
+			mass += 1 / n.m_im;
+		}
+	}
+	if (mass == 0)
+		return;
+
+	if (energy >= threshold * threshold * mass)
+	{
+		psb->setDeactivationTime(0);
+		return;
+	}
+	psb->setDeactivationTime(psb->getDeactivationTime() + timeStep);
+
+	if (!gDisableDeactivation && psb->getDeactivationTime() > gDeactivationTime)
+	{
+		psb->setActivationState(ISLAND_SLEEPING);
+		for (int i = 0; i < psb->m_nodes.size(); i++)
+		{
+			psb->m_nodes[i].m_v = btVector3(0, 0, 0);
+		}
+	}
+}
+
+// Runs one pass over the bodies of groups [startGroup, endGroup)
+void DefaultSoftBodySolver_RunGroups(const SoftBody::DefaultSoftBodySolverWrapper* solver,
+	btSoftBody** bodies, const int* groupStarts, int startGroup, int endGroup,
+	SoftBodySolverPass pass, float solverdt)
+{
+	for (int i = groupStarts[startGroup]; i < groupStarts[endGroup]; i++)
+	{
+		btSoftBody* psb = bodies[i];
+		SoftBody::DefaultSoftBodySolverWrapper::LodState* lodState = solver->findLodState(psb);
+		if (lodState)
+		{
+			// The whole step of a reduced body is done while predicting
+			if (pass == SoftBodySolverPass_PredictMotion)
+			{
+				DefaultSoftBodySolver_StepLodState(lodState, solverdt);
+			}
+			continue;
+		}
+
+		switch (pass)
+		{
+		case SoftBodySolverPass_PredictMotion:
+			psb->predictMotion(solverdt);
+			break;
+		case SoftBodySolverPass_SolveConstraints:
+			psb->solveConstraints();
+			break;
+		case SoftBodySolverPass_SolveConstraintsCustomLinks:
+			DefaultSoftBodySolver_SolveConstraints(psb, solver);
+			break;
+		case SoftBodySolverPass_IntegrateMotion:
+			psb->integrateMotion();
+			break;
+		}
+	}
+}
+
+int DefaultSoftBodySolver_FindRoot(btAlignedObjectArray<int>& parents, int i)
+{
+	while (parents[i] != i)
+	{
+		parents[i] = parents[parents[i]];
+		i = parents[i];
+	}
+	return i;
+}
+
+void DefaultSoftBodySolver_Union(btAlignedObjectArray<int>& parents, int i, int j)
+{
+	i = DefaultSoftBodySolver_FindRoot(parents, i);
+	j = DefaultSoftBodySolver_FindRoot(parents, j);
+	// Keep the lower index as the root so groups are numbered in body order
+	if (i < j)
+		parents[j] = i;
+	else if (j < i)
+		parents[i] = j;
+}
+
+void DefaultSoftBodySolver_UnionRigidBody(btAlignedObjectArray<int>& parents, btHashMap<btHashPtr, int>& rigidBodyOwners,
+	const btCollisionObject* colObj, int body)
+{
+	// Static and kinematic bodies are only read by the soft body solver
+	const btRigidBody* rigidBody = btRigidBody::upcast(colObj);
+	if (rigidBody == 0 || rigidBody->isStaticOrKinematicObject())
+		return;
+
+	int* owner = rigidBodyOwners.find(rigidBody);
+	if (owner)
+	{
+		DefaultSoftBodySolver_Union(parents, *owner, body);
+	}
+	else
+	{
+		rigidBodyOwners.insert(rigidBody, body);
+	}
+}
+
+// Sorts the bodies into groups that write to disjoint data.
+// Bodies are grouped if they share a dynamic rigid body through anchors or rigid contacts,
+// or if one has soft contacts with the faces of the other.
+// Groups and the bodies within them keep their original order.
+void DefaultSoftBodySolver_GroupBodies(const btAlignedObjectArray<btSoftBody*>& bodies, bool connect,
+	btAlignedObjectArray<btSoftBody*>& groupedBodies, btAlignedObjectArray<int>& groupStarts)
+{
+	int numBodies = bodies.size();
+	btAlignedObjectArray<int> parents;
+	parents.resize(numBodies);
+	for (int i = 0; i < numBodies; i++)
+	{
+		parents[i] = i;
+	}
+
+	if (connect)
+	{
+		btHashMap<btHashPtr, int> rigidBodyOwners;
+		for (int i = 0; i < numBodies; i++)
+		{
+			btSoftBody* psb = bodies[i];
+			for (int j = 0; j < psb->m_anchors.size(); j++)
+			{
+				DefaultSoftBodySolver_UnionRigidBody(parents, rigidBodyOwners, psb->m_anchors[j].m_body, i);
+			}
+			for (int j = 0; j < psb->m_rcontacts.size(); j++)
+			{
+				DefaultSoftBodySolver_UnionRigidBody(parents, rigidBodyOwners, psb->m_rcontacts[j].m_cti.m_colObj, i);
+			}
+			for (int j = 0; j < psb->m_scontacts.size(); j++)
+			{
+				const btSoftBody::Face* face = psb->m_scontacts[j].m_face;
+				for (int k = 0; k < numBodies; k++)
+				{
+					const btAlignedObjectArray<btSoftBody::Face>& faces = bodies[k]->m_faces;
+					if (faces.size() != 0 && face >= &faces[0] && face < &faces[0] + faces.size())
+					{
+						DefaultSoftBodySolver_Union(parents, i, k);
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	// Counting sort by group root
+	btAlignedObjectArray<int> groupOfRoot;
+	groupOfRoot.resize(numBodies, -1);
+	btAlignedObjectArray<int> groups;
+	groups.resize(numBodies);
+	int numGroups = 0;
+	for (int i = 0; i < numBodies; i++)
+	{
+		int root = DefaultSoftBodySolver_FindRoot(parents, i);
+		if (groupOfRoot[root] == -1)
+		{
+			groupOfRoot[root] = numGroups++;
+		}
+		groups[i] = groupOfRoot[root];
+	}
+
+	groupStarts.resize(0);
+	groupStarts.resize(numGroups + 1, 0);
+	for (int i = 0; i < numBodies; i++)
+	{
+		groupStarts[groups[i] + 1]++;
+	}
+	for (int i = 0; i < numGroups; i++)
+	{
+		groupStarts[i + 1] += groupStarts[i];
+	}
+
+	btAlignedObjectArray<int> next;
+	next.resize(numGroups);
+	for (int i = 0; i < numGroups; i++)
+	{
+		next[i] = groupStarts[i];
+	}
+	groupedBodies.resize(numBodies);
+	for (int i = 0; i < numBodies; i++)
+	{
+		groupedBodies[next[groups[i]]++] = bodies[i];
+	}
+}
+#pragma managed(pop)
+
+ref class SoftBodySolverJob
+{
+internal:
+	const SoftBody::DefaultSoftBodySolverWrapper* _solver;
+	btSoftBody** _bodies;
+	const int* _groupStarts;
+	int _numGroups;
+	int _groupsPerJob;
+	SoftBodySolverPass _pass;
+	float _solverdt;
+
+	void Run(int job)
+	{
+		int start = job * _groupsPerJob;
+		int end = btMin(start + _groupsPerJob, _numGroups);
+		DefaultSoftBodySolver_RunGroups(_solver, _bodies, _groupStarts, start, end, _pass, _solverdt);
+	}
+};
+
+void DefaultSoftBodySolver_Run(const SoftBody::DefaultSoftBodySolverWrapper* solver,
+	const btAlignedObjectArray<btSoftBody*>& softBodySet, int numThreads,
+	bool connect, SoftBodySolverPass pass, float solverdt)
+{
+	btAlignedObjectArray<btSoftBody*> bodies;
+	for (int i = 0; i < softBodySet.size(); i++)
+	{
+		if (softBodySet[i]->isActive())
+		{
+			bodies.push_back(softBodySet[i]);
+		}
+	}
+	if (bodies.size() == 0)
+		return;
+
+	btAlignedObjectArray<btSoftBody*> groupedBodies;
+	btAlignedObjectArray<int> groupStarts;
+	DefaultSoftBodySolver_GroupBodies(bodies, connect, groupedBodies, groupStarts);
+
+	int numGroups = groupStarts.size() - 1;
+	int numJobs = btMin(numThreads, numGroups);
+	if (numJobs <= 1)
+	{
+		DefaultSoftBodySolver_RunGroups(solver, &groupedBodies[0], &groupStarts[0], 0, numGroups, pass, solverdt);
+		return;
+	}
+
+	SoftBodySolverJob^ job = gcnew SoftBodySolverJob();
+	job->_solver = solver;
+	job->_bodies = &groupedBodies[0];
+	job->_groupStarts = &groupStarts[0];
+	job->_numGroups = numGroups;
+	job->_groupsPerJob = (numGroups + numJobs - 1) / numJobs;
+	job->_pass = pass;
+	job->_solverdt = solverdt;
+	System::Threading::Tasks::Parallel::For(0, numJobs, gcnew Action<int>(job, &SoftBodySolverJob::Run));
+}
+
+ref class SoftBodyLinkJob
+{
+internal:
+	btSoftBody* _softBody;
+	const int* _coloredLinks;
+	int _start;
+	int _end;
+	int _linksPerJob;
+	btScalar _kst;
+	bool _batched;
+
+	void Run(int job)
+	{
+		int start = _start + job * _linksPerJob;
+		int end = btMin(start + _linksPerJob, _end);
+		DefaultSoftBodySolver_PSolveColoredLinks(_softBody, _coloredLinks, start, end, _kst, _batched);
+	}
+};
+
+SoftBody::DefaultSoftBodySolverWrapper::DefaultSoftBodySolverWrapper()
+{
+	_numThreads = 1;
+	_batchedLinks = false;
+	_parallelLinkThreshold = 0;
+	_sleepingThreshold = 0;
+	_lodDistance = 0;
+	_lodViewerPosition.setZero();
+	_timeStep = 0;
+}
+
+SoftBody::DefaultSoftBodySolverWrapper::~DefaultSoftBodySolverWrapper()
+{
+	for (int i = 0; i < _lodStates.size(); i++)
+	{
+		delete *_lodStates.getAtIndex(i);
+	}
+}
+
+SoftBody::DefaultSoftBodySolverWrapper::LodState* SoftBody::DefaultSoftBodySolverWrapper::findLodState(const btSoftBody* psb) const
+{
+	LodState* const* state = _lodStates.find(psb);
+	return state ? *state : 0;
+}
+
+void SoftBody::DefaultSoftBodySolverWrapper::removeLodState(const btSoftBody* psb)
+{
+	LodState* state = findLodState(psb);
+	if (state)
+	{
+		_lodStates.remove(psb);
+		delete state;
+	}
+}
+
+// Solves the colors one after another, splitting the links of each color between the threads
+void SoftBody::DefaultSoftBodySolverWrapper::solveColoredLinks(btSoftBody* psb, const int* coloredLinks,
+	const int* colorStarts, int numColors, btScalar kst) const
+{
+	// Smaller chunks cost more to schedule than to solve
+	const int minLinksPerJob = 256;
+
+	SoftBodyLinkJob^ job = nullptr;
+	for (int color = 0; color < numColors; color++)
+	{
+		int start = colorStarts[color];
+		int end = colorStarts[color + 1];
+		int numJobs = btMin(_numThreads, (end - start + minLinksPerJob - 1) / minLinksPerJob);
+		if (numJobs <= 1)
+		{
+			DefaultSoftBodySolver_PSolveColoredLinks(psb, coloredLinks, start, end, kst, _batchedLinks);
+			continue;
+		}
+
+		if (job == nullptr)
+		{
+			job = gcnew SoftBodyLinkJob();
+			job->_softBody = psb;
+			job->_coloredLinks = coloredLinks;
+			job->_kst = kst;
+			job->_batched = _batchedLinks;
+		}
+		job->_start = start;
+		job->_end = end;
+		// Multiples of four keep the SSE batches whole
+		job->_linksPerJob = ((end - start + numJobs - 1) / numJobs + 3) & ~3;
+		System::Threading::Tasks::Parallel::For(0, numJobs, gcnew Action<int>(job, &SoftBodyLinkJob::Run));
+	}
+}
+
+// Collects the bodies whose faces are in the soft contacts of active bodies.
+// The contacts are stored on the body whose nodes hit the faces, so the owner of the faces doesn't see them.
+void SoftBody::DefaultSoftBodySolverWrapper::findTouchedBodies(btHashMap<btHashPtr, btSoftBody*>& touchedBodies) const
+{
+	for (int i = 0; i < m_softBodySet.size(); i++)
+	{
+		btSoftBody* psb = m_softBodySet[i];
+		if (!psb->isActive())
+			continue;
+
+		for (int j = 0; j < psb->m_scontacts.size(); j++)
+		{
+			btSoftBody* owner = DefaultSoftBodySolver_FindFaceOwner(m_softBodySet, psb->m_scontacts[j].m_face);
+			if (owner && owner != psb)
+			{
+				touchedBodies.insert(owner, owner);
+			}
+		}
+	}
+}
+
+// Wakes sleeping bodies that were touched since the last step.
+// Sleeping bodies aren't predicted, so their contacts are cleared here.
+void SoftBody::DefaultSoftBodySolverWrapper::wakeBodies()
+{
+	for (int i = 0; i < m_softBodySet.size(); i++)
+	{
+		btSoftBody* psb = m_softBodySet[i];
+		if (psb->getActivationState() != ISLAND_SLEEPING)
+			continue;
+
+		if (DefaultSoftBodySolver_IsDisturbed(psb))
+		{
+			psb->activate(true);
+		}
+		else
+		{
+			psb->m_rcontacts.resize(0);
+			psb->m_scontacts.resize(0);
+		}
+	}
+}
+
+// Wakes sleeping bodies whose faces were hit by the nodes of active bodies.
+// Called before solving, since solving the contacts moves the face nodes.
+void SoftBody::DefaultSoftBodySolverWrapper::wakeTouchedBodies()
+{
+	bool anySleeping = false;
+	for (int i = 0; i < m_softBodySet.size(); i++)
+	{
+		if (m_softBodySet[i]->getActivationState() == ISLAND_SLEEPING)
+		{
+			anySleeping = true;
+			break;
+		}
+	}
+	if (!anySleeping)
+		return;
+
+	btHashMap<btHashPtr, btSoftBody*> touchedBodies;
+	findTouchedBodies(touchedBodies);
+	for (int i = 0; i < touchedBodies.size(); i++)
+	{
+		btSoftBody* psb = *touchedBodies.getAtIndex(i);
+		if (psb->getActivationState() == ISLAND_SLEEPING)
+		{
+			psb->activate(true);
+		}
+	}
+}
+
+// Moves bodies between the full and the reduced tier.
+// Reduced bodies return to full detail within _lodDistance and are reduced again beyond 1.1 * _lodDistance.
+void SoftBody::DefaultSoftBodySolverWrapper::updateLodStates()
+{
+	btHashMap<btHashPtr, btSoftBody*> touchedBodies;
+	findTouchedBodies(touchedBodies);
+
+	for (int i = 0; i < m_softBodySet.size(); i++)
+	{
+		btSoftBody* psb = m_softBodySet[i];
+		LodState* state = findLodState(psb);
+		if (!psb->isActive())
+			continue;
+
+		bool reduce = false;
+		if (_lodDistance > 0)
+		{
+			btVector3 closest = _lodViewerPosition;
+			closest.setMax(psb->m_bounds[0]);
+			closest.setMin(psb->m_bounds[1]);
+			btScalar distance = state ? _lodDistance : _lodDistance * btScalar(1.1);
+			reduce = (closest - _lodViewerPosition).length2() > distance * distance;
+		}
+		bool disturbed = DefaultSoftBodySolver_IsDisturbed(psb) || touchedBodies.find(psb) != 0;
+
+		if (state)
+		{
+			// Nodes were added or removed since the proxy was built
+			if (state->proxyNodes.size() != psb->m_nodes.size())
+				reduce = false;
+			if (!reduce || disturbed)
+			{
+				_lodStates.remove(psb);
+				delete state;
+			}
+		}
+		else if (reduce && !disturbed && DefaultSoftBodySolver_CanReduce(psb))
+		{
+			state = DefaultSoftBodySolver_CreateLodState(psb);
+			_lodStates.insert(psb, state);
+		}
+	}
+}
+
+// Drops the states of bodies that are no longer in the world.
+// Bodies removed through the world's collections already dropped theirs in OnSoftBodyRemoved.
+void SoftBody::DefaultSoftBodySolverWrapper::optimize(btAlignedObjectArray<btSoftBody*>& softBodies, bool forceUpdate)
+{
+	btDefaultSoftBodySolver::optimize(softBodies, forceUpdate);
+	if (_lodStates.size() == 0)
+		return;
+
+	btHashMap<btHashPtr, btSoftBody*> bodySet;
+	for (int i = 0; i < m_softBodySet.size(); i++)
+	{
+		bodySet.insert(m_softBodySet[i], m_softBodySet[i]);
+	}
+	btAlignedObjectArray<btSoftBody*> removedBodies;
+	for (int i = 0; i < _lodStates.size(); i++)
+	{
+		btSoftBody* psb = (*_lodStates.getAtIndex(i))->body;
+		if (bodySet.find(psb) == 0)
+			removedBodies.push_back(psb);
+	}
+	for (int i = 0; i < removedBodies.size(); i++)
+	{
+		removeLodState(removedBodies[i]);
+	}
+}
+
+void SoftBody::DefaultSoftBodySolverWrapper::predictMotion(float solverdt)
+{
+	_timeStep = solverdt;
+	wakeBodies();
+	if (_lodDistance > 0 || _lodStates.size() != 0)
+	{
+		updateLodStates();
+	}
+
+	if (_numThreads <= 1 && _lodStates.size() == 0)
+	{
+		btDefaultSoftBodySolver::predictMotion(solverdt);
+		return;
+	}
+
+	// predictMotion moves the broadphase proxy, which can't be done concurrently.
+	// Detach the proxies while predicting and move them afterwards in body order.
+	btAlignedObjectArray<btBroadphaseProxy*> handles;
+	handles.resize(m_softBodySet.size());
+	for (int i = 0; i < m_softBodySet.size(); i++)
+	{
+		btSoftBody* psb = m_softBodySet[i];
+		handles[i] = psb->getBroadphaseHandle();
+		if (psb->isActive())
+		{
+			psb->setBroadphaseHandle(0);
+		}
+	}
+
+	DefaultSoftBodySolver_Run(this, m_softBodySet, _numThreads, false, SoftBodySolverPass_PredictMotion, solverdt);
+
+	for (int i = 0; i < m_softBodySet.size(); i++)
+	{
+		btSoftBody* psb = m_softBodySet[i];
+		if (psb->isActive())
+		{
+			psb->setBroadphaseHandle(handles[i]);
+			if (handles[i])
+			{
+				btSoftBodyWorldInfo* worldInfo = psb->getWorldInfo();
+				worldInfo->m_broadphase->setAabb(handles[i], psb->m_bounds[0], psb->m_bounds[1], worldInfo->m_dispatcher);
+			}
+		}
+	}
+}
+
+void SoftBody::DefaultSoftBodySolverWrapper::solveConstraints(float solverdt)
+{
+	wakeTouchedBodies();
+
+	bool customLinks = _batchedLinks || _parallelLinkThreshold > 0;
+	if (_numThreads <= 1 && !customLinks && _lodStates.size() == 0)
+	{
+		btDefaultSoftBodySolver::solveConstraints(solverdt);
+		return;
+	}
+
+	DefaultSoftBodySolver_Run(this, m_softBodySet, _numThreads, true,
+		customLinks ? SoftBodySolverPass_SolveConstraintsCustomLinks : SoftBodySolverPass_SolveConstraints, solverdt);
+}
+
+void SoftBody::DefaultSoftBodySolverWrapper::updateSoftBodies()
+{
+	if (_numThreads <= 1 && _lodStates.size() == 0)
+	{
+		btDefaultSoftBodySolver::updateSoftBodies();
+	}
+	else
+	{
+		DefaultSoftBodySolver_Run(this, m_softBodySet, _numThreads, false, SoftBodySolverPass_IntegrateMotion, 0);
+	}
+
+	if (_sleepingThreshold > 0)
+	{
+		for (int i = 0; i < m_softBodySet.size(); i++)
+		{
+			DefaultSoftBodySolver_UpdateDeactivation(m_softBodySet[i], _sleepingThreshold, _timeStep);
+		}
+	}
+}
+
 #endif
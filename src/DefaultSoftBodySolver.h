@@ -11,10 +11,111 @@ namespace BulletSharp
 
 		public ref class DefaultSoftBodySolver : SoftBodySolver
 		{
+		internal:
+			void OnSoftBodyRemoved(SoftBody^ softBody);
+
 		public:
 			DefaultSoftBodySolver();
 
 			void CopySoftBodyToVertexBuffer(SoftBody^ softBody, VertexBufferDescriptor^ vertexBuffer);
+			// Copies the nodes of several bodies into one CPU vertex buffer with a single native call.
+			// The nodes of softBodies[i] are written starting at vertex baseVertices[i] of the buffer.
+			// With halfPrecisionNormals, each normal is written as four 16-bit floats (w = 0)
+			// that take up two floats at the normal offset.
+			void CopySoftBodiesToVertexBuffer(array<SoftBody^>^ softBodies, array<int>^ baseVertices,
+				VertexBufferDescriptor^ vertexBuffer, bool halfPrecisionNormals);
+			void CopySoftBodiesToVertexBuffer(array<SoftBody^>^ softBodies, array<int>^ baseVertices,
+				VertexBufferDescriptor^ vertexBuffer);
+
+			// Number of threads used to predict, solve and integrate soft bodies, 1 by default.
+			// Bodies that touch the same dynamic rigid body or each other are solved on the same
+			// thread in their original order, so the results match the single-threaded solver.
+			property int NumThreads
+			{
+				int get();
+				void set(int value);
+			}
+
+			// Solves the linear (PSolver.Linear) link constraints in batches of four consecutive links
+			// that share no nodes, using SSE where available. Runs of independent links are longest
+			// after SoftBodyHelpers.ReoptimizeLinkOrder. Off by default.
+			property bool UseBatchedLinkSolver
+			{
+				bool get();
+				void set(bool value);
+			}
+
+			// Bodies with at least this many links solve the linear (PSolver.Linear) link constraints
+			// in graph-colored batches split between NumThreads threads. Links of one color share no nodes,
+			// so the result doesn't depend on the thread count, but the links are solved in a different
+			// order than with the serial solver. 0 (the default) disables it.
+			property int ParallelLinkThreshold
+			{
+				int get();
+				void set(int value);
+			}
+
+			// Mass-weighted RMS node speed below which a body starts to fall asleep. Bodies that stay
+			// below it for the deactivation time are put in the IslandSleeping state and skipped by the
+			// solver until they are activated, touched by a moving body or anchored to one that moves.
+			// Bodies with the DisableDeactivation state never sleep. 0 (the default) disables sleeping.
+			property btScalar SleepingThreshold
+			{
+				btScalar get();
+				void set(btScalar value);
+			}
+
+			// Distance from LodViewerPosition beyond which pinned bodies with clusters
+			// (see SoftBody.GenerateClusters) are simulated as a coarse proxy with one node per cluster.
+			// The full mesh follows the proxy without collisions until the body comes within
+			// the distance again or is touched by a moving body. 0 (the default) disables the reduced tier.
+			property btScalar LodDistance
+			{
+				btScalar get();
+				void set(btScalar value);
+			}
+
+			property Vector3 LodViewerPosition
+			{
+				Vector3 get();
+				void set(Vector3 value);
+			}
+
+			bool IsReducedLod(SoftBody^ softBody);
+		};
+
+		class DefaultSoftBodySolverWrapper : public btDefaultSoftBodySolver
+		{
+		public:
+			struct LodState;
+
+			int _numThreads;
+			bool _batchedLinks;
+			int _parallelLinkThreshold;
+			btScalar _sleepingThreshold;
+			btScalar _lodDistance;
+			btVector3 _lodViewerPosition;
+			float _timeStep;
+			btHashMap<btHashPtr, LodState*> _lodStates;
+
+			BT_DECLARE_ALIGNED_ALLOCATOR();
+
+			DefaultSoftBodySolverWrapper();
+			virtual ~DefaultSoftBodySolverWrapper();
+
+			LodState* findLodState(const btSoftBody* psb) const;
+			void removeLodState(const btSoftBody* psb);
+			void findTouchedBodies(btHashMap<btHashPtr, btSoftBody*>& touchedBodies) const;
+			void wakeBodies();
+			void wakeTouchedBodies();
+			void updateLodStates();
+			void solveColoredLinks(btSoftBody* psb, const int* coloredLinks, const int* colorStarts,
+				int numColors, btScalar kst) const;
+
+			virtual void optimize(btAlignedObjectArray<btSoftBody*>& softBodies, bool forceUpdate = false);
+			virtual void predictMotion(float solverdt);
+			virtual void solveConstraints(float solverdt);
+			virtual void updateSoftBodies();
 		};
 	};
 };
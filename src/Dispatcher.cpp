@@ -1,5 +1,6 @@
 #include "StdAfx.h"
 
+#include "AlignedObjectArray.h"
 #include "CollisionAlgorithm.h"
 #include "CollisionObjectWrapper.h"
 #include "Dispatcher.h"
@@ -168,6 +169,122 @@ void DispatcherInfo::UseEpa::set(bool value)
 }
 
 
+ContactSnapshot::ContactSnapshot()
+{
+	Reserve(0, 0);
+}
+
+ContactSnapshot::ContactSnapshot(int manifoldCapacity, int pointCapacity)
+{
+	Reserve(manifoldCapacity, pointCapacity);
+}
+
+void ContactSnapshot::Reserve(int numManifolds, int numPoints)
+{
+	if (_bodiesA == nullptr || _bodiesA->Length < numManifolds)
+	{
+		int capacity = (_bodiesA != nullptr) ? btMax(numManifolds, _bodiesA->Length * 2) : numManifolds;
+		_bodiesA = gcnew array<CollisionObject^>(capacity);
+		_bodiesB = gcnew array<CollisionObject^>(capacity);
+		_handlesA = gcnew array<int>(capacity);
+		_handlesB = gcnew array<int>(capacity);
+		_pointCounts = gcnew array<int>(capacity);
+		_pointOffsets = gcnew array<int>(capacity);
+	}
+	if (_distances == nullptr || _distances->Length < numPoints)
+	{
+		int capacity = (_distances != nullptr) ? btMax(numPoints, _distances->Length * 2) : numPoints;
+		_positionsWorldOnA = gcnew array<Vector3>(capacity);
+		_positionsWorldOnB = gcnew array<Vector3>(capacity);
+		_normalsWorldOnB = gcnew array<Vector3>(capacity);
+		_distances = gcnew array<btScalar>(capacity);
+		_appliedImpulses = gcnew array<btScalar>(capacity);
+	}
+}
+
+array<btScalar>^ ContactSnapshot::AppliedImpulses::get()
+{
+	return _appliedImpulses;
+}
+
+void ContactSnapshot_ResolveBodies(ContactSnapshot^ snapshot)
+{
+	AlignedCollisionObjectArray^ objectTable = snapshot->_objectTable;
+	for (int i = 0; i < snapshot->_numManifolds; i++)
+	{
+		if (snapshot->_handlesA[i] != 0)
+			snapshot->_bodiesA[i] = objectTable->GetByHandleInternal(snapshot->_handlesA[i]);
+		if (snapshot->_handlesB[i] != 0)
+			snapshot->_bodiesB[i] = objectTable->GetByHandleInternal(snapshot->_handlesB[i]);
+	}
+	snapshot->_bodiesResolved = true;
+}
+
+array<CollisionObject^>^ ContactSnapshot::BodiesA::get()
+{
+	if (!_bodiesResolved)
+		ContactSnapshot_ResolveBodies(this);
+	return _bodiesA;
+}
+
+array<CollisionObject^>^ ContactSnapshot::BodiesB::get()
+{
+	if (!_bodiesResolved)
+		ContactSnapshot_ResolveBodies(this);
+	return _bodiesB;
+}
+
+array<btScalar>^ ContactSnapshot::Distances::get()
+{
+	return _distances;
+}
+
+array<int>^ ContactSnapshot::HandlesA::get()
+{
+	return _handlesA;
+}
+
+array<int>^ ContactSnapshot::HandlesB::get()
+{
+	return _handlesB;
+}
+
+array<Vector3>^ ContactSnapshot::NormalsWorldOnB::get()
+{
+	return _normalsWorldOnB;
+}
+
+int ContactSnapshot::NumManifolds::get()
+{
+	return _numManifolds;
+}
+
+int ContactSnapshot::NumPoints::get()
+{
+	return _numPoints;
+}
+
+array<int>^ ContactSnapshot::PointCounts::get()
+{
+	return _pointCounts;
+}
+
+array<int>^ ContactSnapshot::PointOffsets::get()
+{
+	return _pointOffsets;
+}
+
+array<Vector3>^ ContactSnapshot::PositionsWorldOnA::get()
+{
+	return _positionsWorldOnA;
+}
+
+array<Vector3>^ ContactSnapshot::PositionsWorldOnB::get()
+{
+	return _positionsWorldOnB;
+}
+
+
 Dispatcher::Dispatcher(btDispatcher* native)
 {
 	_native = native;
@@ -219,6 +336,122 @@ void Dispatcher::FreeCollisionAlgorithm(IntPtr ptr)
 	_native->freeCollisionAlgorithm(ptr.ToPointer());
 }
 
+#pragma managed(push, off)
+bool Dispatcher_ManifoldPassesFilter(const btPersistentManifold* manifold, btScalar distanceThreshold)
+{
+	int numContacts = manifold->getNumContacts();
+	for (int i = 0; i < numContacts; i++)
+	{
+		if (manifold->getContactPoint(i).getDistance() <= distanceThreshold)
+			return true;
+	}
+	return false;
+}
+
+// Counts the manifolds and points that pass the filter and compacts the manifold indices
+int Dispatcher_FilterManifolds(btPersistentManifold** manifolds, int numManifolds,
+	btScalar distanceThreshold, bool useThreshold, int* filtered, int* numPoints)
+{
+	int count = 0;
+	*numPoints = 0;
+	for (int i = 0; i < numManifolds; i++)
+	{
+		btPersistentManifold* manifold = manifolds[i];
+		int numContacts = manifold->getNumContacts();
+		if (numContacts == 0)
+			continue;
+		if (useThreshold && !Dispatcher_ManifoldPassesFilter(manifold, distanceThreshold))
+			continue;
+
+		filtered[count++] = i;
+		*numPoints += numContacts;
+	}
+	return count;
+}
+#pragma managed(pop)
+
+int Dispatcher_GetContactSnapshot(btDispatcher* dispatcher, ContactSnapshot^ snapshot,
+	btScalar distanceThreshold, bool useThreshold, AlignedCollisionObjectArray^ objectTable)
+{
+	if (snapshot == nullptr)
+		throw gcnew ArgumentNullException("snapshot");
+
+	snapshot->_numManifolds = 0;
+	snapshot->_numPoints = 0;
+	snapshot->_objectTable = objectTable;
+	snapshot->_bodiesResolved = false;
+
+	int numManifolds = dispatcher->getNumManifolds();
+	if (numManifolds == 0)
+		return 0;
+
+	if (snapshot->_manifoldIndices == nullptr || snapshot->_manifoldIndices->Length < numManifolds)
+	{
+		int capacity = (snapshot->_manifoldIndices != nullptr) ?
+			btMax(numManifolds, snapshot->_manifoldIndices->Length * 2) : numManifolds;
+		snapshot->_manifoldIndices = gcnew array<int>(capacity);
+	}
+
+	btPersistentManifold** manifolds = dispatcher->getInternalManifoldPointer();
+	pin_ptr<int> filtered = &snapshot->_manifoldIndices[0];
+	int numPoints;
+	numManifolds = Dispatcher_FilterManifolds(manifolds, numManifolds,
+		distanceThreshold, useThreshold, filtered, &numPoints);
+	snapshot->Reserve(numManifolds, numPoints);
+
+	array<CollisionObject^>^ bodiesA = snapshot->_bodiesA;
+	array<CollisionObject^>^ bodiesB = snapshot->_bodiesB;
+	array<int>^ handlesA = snapshot->_handlesA;
+	array<int>^ handlesB = snapshot->_handlesB;
+	array<int>^ pointCounts = snapshot->_pointCounts;
+	array<int>^ pointOffsets = snapshot->_pointOffsets;
+	array<Vector3>^ positionsWorldOnA = snapshot->_positionsWorldOnA;
+	array<Vector3>^ positionsWorldOnB = snapshot->_positionsWorldOnB;
+	array<Vector3>^ normalsWorldOnB = snapshot->_normalsWorldOnB;
+	array<btScalar>^ distances = snapshot->_distances;
+	array<btScalar>^ appliedImpulses = snapshot->_appliedImpulses;
+
+	int pointIndex = 0;
+	for (int i = 0; i < numManifolds; i++)
+	{
+		const btPersistentManifold* manifold = manifolds[filtered[i]];
+		int numContacts = manifold->getNumContacts();
+		btCollisionObject* body0 = (btCollisionObject*)manifold->getBody0();
+		btCollisionObject* body1 = (btCollisionObject*)manifold->getBody1();
+		handlesA[i] = objectTable ? objectTable->GetHandle(body0) : 0;
+		handlesB[i] = objectTable ? objectTable->GetHandle(body1) : 0;
+		// Bodies with handles are resolved when BodiesA/BodiesB is read
+		bodiesA[i] = (handlesA[i] != 0) ? nullptr : CollisionObject::GetManaged(body0);
+		bodiesB[i] = (handlesB[i] != 0) ? nullptr : CollisionObject::GetManaged(body1);
+		pointCounts[i] = numContacts;
+		pointOffsets[i] = pointIndex;
+
+		for (int j = 0; j < numContacts; j++)
+		{
+			const btManifoldPoint& point = manifold->getContactPoint(j);
+			Math::BtVector3ToVector3(&point.m_positionWorldOnA, positionsWorldOnA[pointIndex]);
+			Math::BtVector3ToVector3(&point.m_positionWorldOnB, positionsWorldOnB[pointIndex]);
+			Math::BtVector3ToVector3(&point.m_normalWorldOnB, normalsWorldOnB[pointIndex]);
+			distances[pointIndex] = point.m_distance1;
+			appliedImpulses[pointIndex] = point.m_appliedImpulse;
+			pointIndex++;
+		}
+	}
+	snapshot->_numManifolds = numManifolds;
+	snapshot->_numPoints = numPoints;
+	return numManifolds;
+}
+
+int Dispatcher::GetContactSnapshot(ContactSnapshot^ snapshot)
+{
+	return Dispatcher_GetContactSnapshot(_native, snapshot, 0, false, _collisionObjectArray);
+}
+
+int Dispatcher::GetContactSnapshot(ContactSnapshot^ snapshot, btScalar distanceThreshold)
+{
+	return Dispatcher_GetContactSnapshot(_native, snapshot, distanceThreshold, true, _collisionObjectArray);
+}
+
 #ifndef DISABLE_INTERNAL
 PersistentManifold Dispatcher::GetManifoldByIndexInternal(int index)
 {
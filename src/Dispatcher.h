@@ -4,6 +4,7 @@
 
 namespace BulletSharp
 {
+	ref class AlignedCollisionObjectArray;
 	ref struct BroadphasePair;
 	ref class BroadphaseProxy;
 	ref class CollisionAlgorithm;
@@ -113,11 +114,113 @@ namespace BulletSharp
 		}
 	};
 
+	// Flat copy of the contact manifolds of a dispatcher, filled by Dispatcher::GetContactSnapshot.
+	// Manifold i owns the points PointOffsets[i] to PointOffsets[i] + PointCounts[i] - 1.
+	// The arrays are reused between snapshots and may be longer than NumManifolds/NumPoints.
+	public ref class ContactSnapshot
+	{
+	internal:
+		int _numManifolds;
+		int _numPoints;
+		array<CollisionObject^>^ _bodiesA;
+		array<CollisionObject^>^ _bodiesB;
+		bool _bodiesResolved;
+		array<int>^ _handlesA;
+		array<int>^ _handlesB;
+		AlignedCollisionObjectArray^ _objectTable;
+		array<int>^ _pointCounts;
+		array<int>^ _pointOffsets;
+		array<Vector3>^ _positionsWorldOnA;
+		array<Vector3>^ _positionsWorldOnB;
+		array<Vector3>^ _normalsWorldOnB;
+		array<btScalar>^ _distances;
+		array<btScalar>^ _appliedImpulses;
+		// Indices of the manifolds that passed the filter, reused between snapshots
+		array<int>^ _manifoldIndices;
+
+		void Reserve(int numManifolds, int numPoints);
+
+	public:
+		ContactSnapshot();
+		ContactSnapshot(int manifoldCapacity, int pointCapacity);
+
+		property array<btScalar>^ AppliedImpulses
+		{
+			array<btScalar>^ get();
+		}
+
+		// Resolved from HandlesA/HandlesB on first access after a snapshot.
+		// Bodies removed from the world since the snapshot are null.
+		property array<CollisionObject^>^ BodiesA
+		{
+			array<CollisionObject^>^ get();
+		}
+
+		property array<CollisionObject^>^ BodiesB
+		{
+			array<CollisionObject^>^ get();
+		}
+
+		property array<btScalar>^ Distances
+		{
+			array<btScalar>^ get();
+		}
+
+		// CollisionObject.WorldHandle of the bodies, 0 if the dispatcher
+		// doesn't belong to a world or the body has no handle
+		property array<int>^ HandlesA
+		{
+			array<int>^ get();
+		}
+
+		property array<int>^ HandlesB
+		{
+			array<int>^ get();
+		}
+
+		property array<Vector3>^ NormalsWorldOnB
+		{
+			array<Vector3>^ get();
+		}
+
+		property int NumManifolds
+		{
+			int get();
+		}
+
+		property int NumPoints
+		{
+			int get();
+		}
+
+		property array<int>^ PointCounts
+		{
+			array<int>^ get();
+		}
+
+		property array<int>^ PointOffsets
+		{
+			array<int>^ get();
+		}
+
+		property array<Vector3>^ PositionsWorldOnA
+		{
+			array<Vector3>^ get();
+		}
+
+		property array<Vector3>^ PositionsWorldOnB
+		{
+			array<Vector3>^ get();
+		}
+	};
+
 	public ref class Dispatcher abstract
 	{
 	internal:
 		btDispatcher* _native;
 		Dictionary<IntPtr, DispatcherInfo^>^ _dispatcherInfoRefs;
+		// Objects of the world using this dispatcher, for WorldHandle lookups
+		AlignedCollisionObjectArray^ _collisionObjectArray;
 
 		Dispatcher(btDispatcher* native);
 
@@ -138,6 +241,11 @@ namespace BulletSharp
 			PersistentManifold sharedManifold);
 		CollisionAlgorithm^ FindAlgorithm(CollisionObjectWrapper^ body0Wrap, CollisionObjectWrapper^ body1Wrap);
 		void FreeCollisionAlgorithm(IntPtr ptr);
+		// Copies all manifolds that have contact points into the snapshot in one pass.
+		// Returns the number of manifolds copied.
+		int GetContactSnapshot(ContactSnapshot^ snapshot);
+		// Copies only manifolds with at least one point at or below distanceThreshold.
+		int GetContactSnapshot(ContactSnapshot^ snapshot, btScalar distanceThreshold);
 #ifndef DISABLE_INTERNAL
 		PersistentManifold GetManifoldByIndexInternal(int index);
 #endif
@@ -199,10 +199,9 @@ void World_GetGravity(btDynamicsWorld* world, btVector3* gravity)
 
 Vector3 DynamicsWorld::Gravity::get()
 {
-	btVector3* gravityTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, gravityTemp);
 	World_GetGravity(Native, gravityTemp);
 	Vector3 gravity = Math::BtVector3ToVector3(gravityTemp);
-	ALIGNED_FREE(gravityTemp);
 	return gravity;
 }
 void DynamicsWorld::Gravity::set(Vector3 gravity)
@@ -108,6 +108,13 @@ namespace BulletSharp
 		AllFilter = btBroadphaseProxy::AllFilter
 	};
 
+	public enum class CollisionObjectFilterMode
+	{
+		Disabled,
+		Exclude,
+		IncludeOnly
+	};
+
 	public enum class ConstraintParam
 	{
 		Erp = BT_CONSTRAINT_ERP,
@@ -148,6 +155,18 @@ namespace BulletSharp
 		DrawFrames = btIDebugDraw::DBG_DrawFrames,
 		MaxDebugDrawMode = btIDebugDraw::DBG_MAX_DEBUG_DRAW_MODE
 	};
+
+	[Flags]
+	public enum class DebugDrawCategories
+	{
+		None = 0,
+		Lines = 1,
+		Aabbs = 2,
+		ContactPoints = 4,
+		Transforms = 8,
+		Triangles = 16,
+		All = Lines | Aabbs | ContactPoints | Transforms | Triangles
+	};
 #endif
 
 #pragma warning(push)
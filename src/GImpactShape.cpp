@@ -44,23 +44,21 @@ GImpactShapeInterface::GImpactShapeInterface(btGImpactShapeInterface* native)
 void GImpactShapeInterface::GetAabb(Matrix% t, Vector3% aabbMin, Vector3% aabbMax)
 {
 	// Override required because inlined code doesn't work in C++/CLI (btAABB not aligned)
-	btAABB* transformedBox = ALIGNED_NEW(btAABB) (Native->getLocalBox());
+	ALIGNED_STACK(btAABB, transformedBox) (Native->getLocalBox());
 	TRANSFORM_CONV(t);
 	transformedBox->appy_transform(TRANSFORM_USE(t));
 	Math::BtVector3ToVector3(&transformedBox->m_min, aabbMin);
 	Math::BtVector3ToVector3(&transformedBox->m_max, aabbMax);
-	ALIGNED_FREE(transformedBox);
 }
 
 void GImpactShapeInterface::GetAabb(Matrix t, Vector3% aabbMin, Vector3% aabbMax)
 {
 	// Override required because inlined code doesn't work in C++/CLI (btAABB doesn't get aligned)
-	btAABB* transformedBox = ALIGNED_NEW(btAABB) (Native->getLocalBox());
+	ALIGNED_STACK(btAABB, transformedBox) (Native->getLocalBox());
 	TRANSFORM_CONV(t);
 	transformedBox->appy_transform(TRANSFORM_USE(t));
 	Math::BtVector3ToVector3(&transformedBox->m_min, aabbMin);
 	Math::BtVector3ToVector3(&transformedBox->m_max, aabbMax);
-	ALIGNED_FREE(transformedBox);
 }
 
 void GImpactShapeInterface::GetBulletTetrahedron(int primIndex, TetrahedronShapeEx^ tetrahedron)
@@ -77,14 +75,12 @@ void GImpactShapeInterface::GetChildAabb(int childIndex, Matrix t, Vector3% aabb
 	Vector3% aabbMax)
 {
 	TRANSFORM_CONV(t);
-	btVector3* aabbMinTemp = ALIGNED_NEW(btVector3);
-	btVector3* aabbMaxTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, aabbMinTemp);
+	ALIGNED_STACK(btVector3, aabbMaxTemp);
 	Native->getChildAabb(childIndex, TRANSFORM_USE(t), VECTOR3_USE(aabbMin), VECTOR3_USE(aabbMax));
 	TRANSFORM_DEL(t);
 	Math::BtVector3ToVector3(aabbMinTemp, aabbMin);
 	Math::BtVector3ToVector3(aabbMaxTemp, aabbMax);
-	ALIGNED_FREE(aabbMinTemp);
-	ALIGNED_FREE(aabbMaxTemp);
 }
 
 CollisionShape^ GImpactShapeInterface::GetChildShape(int index)
@@ -93,19 +89,16 @@ CollisionShape^ GImpactShapeInterface::GetChildShape(int index)
 }
 
 #pragma managed(push, off)
-btTransform* GImpactShapeInterface_GetChildTransform(btGImpactShapeInterface* shape, int index)
+void GImpactShapeInterface_GetChildTransform(btGImpactShapeInterface* shape, int index, btTransform* transform)
 {
-	btTransform* transform = ALIGNED_NEW(btTransform);
 	*transform = shape->getChildTransform(index);
-	return transform;
 }
 #pragma managed(pop)
 Matrix GImpactShapeInterface::GetChildTransform(int index)
 {
-	btTransform* transformTemp = GImpactShapeInterface_GetChildTransform(Native, index);
-	Matrix transform = Math::BtTransformToMatrix(transformTemp);
-	ALIGNED_FREE(transformTemp);
-	return transform;
+	ALIGNED_STACK(btTransform, transformTemp);
+	GImpactShapeInterface_GetChildTransform(Native, index, transformTemp);
+	return Math::BtTransformToMatrix(transformTemp);
 }
 
 void GImpactShapeInterface::GetPrimitiveTriangle(int index, PrimitiveTriangle^ triangle)
@@ -334,10 +327,9 @@ void GImpactMeshShapePart::TrimeshPrimitiveManager::GetIndices(int faceIndex, un
 void GImpactMeshShapePart::TrimeshPrimitiveManager::GetVertex(unsigned int vertexIndex,
 	[Out] Vector3% vertex)
 {
-	btVector3* vertexTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, vertexTemp);
 	Native->get_vertex(vertexIndex, *vertexTemp);
 	Math::BtVector3ToVector3(vertexTemp, vertex);
-	ALIGNED_FREE(vertexTemp);
 }
 
 void GImpactMeshShapePart::TrimeshPrimitiveManager::Lock()
@@ -495,10 +487,9 @@ GImpactMeshShapePart::GImpactMeshShapePart(StridingMeshInterface^ meshInterface,
 
 void GImpactMeshShapePart::GetVertex(int vertexIndex, [Out] Vector3% vertex)
 {
-	btVector3* vertexTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, vertexTemp);
 	Native->getVertex(vertexIndex, *vertexTemp);
 	Math::BtVector3ToVector3(vertexTemp, vertex);
-	ALIGNED_FREE(vertexTemp);
 }
 
 #ifndef DISABLE_BVH
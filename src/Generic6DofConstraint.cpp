@@ -596,10 +596,9 @@ void Generic6DofConstraint::UpdateRhs(btScalar timeStep)
 
 Vector3 Generic6DofConstraint::AngularLowerLimit::get()
 {
-	btVector3* limitTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, limitTemp);
 	Native->getAngularLowerLimit(*limitTemp);
 	Vector3 limit = Math::BtVector3ToVector3(limitTemp);
-	ALIGNED_FREE(limitTemp);
 	return limit;
 }
 void Generic6DofConstraint::AngularLowerLimit::set(Vector3 angularLower)
@@ -611,10 +610,9 @@ void Generic6DofConstraint::AngularLowerLimit::set(Vector3 angularLower)
 
 Vector3 Generic6DofConstraint::AngularUpperLimit::get()
 {
-	btVector3* limitTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, limitTemp);
 	Native->getAngularUpperLimit(*limitTemp);
 	Vector3 limit = Math::BtVector3ToVector3(limitTemp);
-	ALIGNED_FREE(limitTemp);
 	return limit;
 }
 void Generic6DofConstraint::AngularUpperLimit::set(Vector3 angularUpper)
@@ -641,18 +639,18 @@ Matrix Generic6DofConstraint::FrameOffsetA::get()
 void Generic6DofConstraint::FrameOffsetA::set(Matrix value)
 {
 #if defined(BT_USE_SIMD_VECTOR3) && defined(BT_USE_SSE_IN_API) && defined(BT_USE_SSE)
-	btScalar* m = (btScalar*)btAlignedAlloc(sizeof(btScalar) * 16, 16);
-	btTransform* a = Math::MatrixToBtTransform(value);
+	ALIGNED_STACK_STORAGE(m, btScalar[16]);
+	btScalar* m = (btScalar*)ALIGNED_STACK_PTR(m);
+	ALIGNED_STACK(btTransform, a);
+	Math::MatrixToBtTransform(value, a);
 	a->getOpenGLMatrix(m);
 	Native->getFrameOffsetA().setFromOpenGLMatrix(m);
-	ALIGNED_FREE(m);
-	ALIGNED_FREE(a);
 #else
 	btScalar m[16];
-	btTransform* a = Math::MatrixToBtTransform(value);
+	ALIGNED_STACK(btTransform, a);
+	Math::MatrixToBtTransform(value, a);
 	a->getOpenGLMatrix(m);
 	Native->getFrameOffsetA().setFromOpenGLMatrix(m);
-	ALIGNED_FREE(a);
 #endif
 }
 
@@ -663,27 +661,26 @@ Matrix Generic6DofConstraint::FrameOffsetB::get()
 void Generic6DofConstraint::FrameOffsetB::set(Matrix value)
 {
 #if defined(BT_USE_SIMD_VECTOR3) && defined(BT_USE_SSE_IN_API) && defined(BT_USE_SSE)
-	btScalar* m = (btScalar*)btAlignedAlloc(sizeof(btScalar) * 16, 16);
-	btTransform* a = Math::MatrixToBtTransform(value);
+	ALIGNED_STACK_STORAGE(m, btScalar[16]);
+	btScalar* m = (btScalar*)ALIGNED_STACK_PTR(m);
+	ALIGNED_STACK(btTransform, a);
+	Math::MatrixToBtTransform(value, a);
 	a->getOpenGLMatrix(m);
 	Native->getFrameOffsetB().setFromOpenGLMatrix(m);
-	btAlignedFree(m);
-	ALIGNED_FREE(a);
 #else
 	btScalar m[16];
-	btTransform* a = Math::MatrixToBtTransform(value);
+	ALIGNED_STACK(btTransform, a);
+	Math::MatrixToBtTransform(value, a);
 	a->getOpenGLMatrix(m);
 	Native->getFrameOffsetB().setFromOpenGLMatrix(m);
-	ALIGNED_FREE(a);
 #endif
 }
 
 Vector3 Generic6DofConstraint::LinearLowerLimit::get()
 {
-	btVector3* limitTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, limitTemp);
 	Native->getLinearLowerLimit(*limitTemp);
 	Vector3 limit = Math::BtVector3ToVector3(limitTemp);
-	ALIGNED_FREE(limitTemp);
 	return limit;
 }
 void Generic6DofConstraint::LinearLowerLimit::set(Vector3 linearLower)
@@ -695,10 +692,9 @@ void Generic6DofConstraint::LinearLowerLimit::set(Vector3 linearLower)
 
 Vector3 Generic6DofConstraint::LinearUpperLimit::get()
 {
-	btVector3* limitTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, limitTemp);
 	Native->getLinearUpperLimit(*limitTemp);
 	Vector3 limit = Math::BtVector3ToVector3(limitTemp);
-	ALIGNED_FREE(limitTemp);
 	return limit;
 }
 void Generic6DofConstraint::LinearUpperLimit::set(Vector3 linearUpper)
@@ -678,10 +678,9 @@ void Generic6DofSpring2Constraint::SetTargetVelocity(int index, btScalar velocit
 
 Vector3 Generic6DofSpring2Constraint::AngularLowerLimit::get()
 {
-	btVector3* angularLowerTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, angularLowerTemp);
 	Native->getAngularLowerLimit(*angularLowerTemp);
 	Vector3 ret = Math::BtVector3ToVector3(angularLowerTemp);
-	ALIGNED_FREE(angularLowerTemp);
 	return ret;
 }
 void Generic6DofSpring2Constraint::AngularLowerLimit::set(Vector3 angularLower)
@@ -693,10 +692,9 @@ void Generic6DofSpring2Constraint::AngularLowerLimit::set(Vector3 angularLower)
 
 Vector3 Generic6DofSpring2Constraint::AngularLowerLimitReversed::get()
 {
-	btVector3* angularLowerTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, angularLowerTemp);
 	Native->getAngularLowerLimitReversed(*angularLowerTemp);
 	Vector3 ret = Math::BtVector3ToVector3(angularLowerTemp);
-	ALIGNED_FREE(angularLowerTemp);
 	return ret;
 }
 void Generic6DofSpring2Constraint::AngularLowerLimitReversed::set(Vector3 angularLower)
@@ -708,10 +706,9 @@ void Generic6DofSpring2Constraint::AngularLowerLimitReversed::set(Vector3 angula
 
 Vector3 Generic6DofSpring2Constraint::AngularUpperLimit::get()
 {
-	btVector3* angularUpperTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, angularUpperTemp);
 	Native->getAngularUpperLimit(*angularUpperTemp);
 	Vector3 ret = Math::BtVector3ToVector3(angularUpperTemp);
-	ALIGNED_FREE(angularUpperTemp);
 	return ret;
 }
 void Generic6DofSpring2Constraint::AngularUpperLimit::set(Vector3 angularUpper)
@@ -723,10 +720,9 @@ void Generic6DofSpring2Constraint::AngularUpperLimit::set(Vector3 angularUpper)
 
 Vector3 Generic6DofSpring2Constraint::AngularUpperLimitReversed::get()
 {
-	btVector3* angularUpperTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, angularUpperTemp);
 	Native->getAngularUpperLimitReversed(*angularUpperTemp);
 	Vector3 ret = Math::BtVector3ToVector3(angularUpperTemp);
-	ALIGNED_FREE(angularUpperTemp);
 	return ret;
 }
 void Generic6DofSpring2Constraint::AngularUpperLimitReversed::set(Vector3 angularUpper)
@@ -758,10 +754,9 @@ Matrix Generic6DofSpring2Constraint::FrameOffsetB::get()
 
 Vector3 Generic6DofSpring2Constraint::LinearLowerLimit::get()
 {
-	btVector3* linearLowerTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, linearLowerTemp);
 	Native->getLinearLowerLimit(*linearLowerTemp);
 	Vector3 ret = Math::BtVector3ToVector3(linearLowerTemp);
-	ALIGNED_FREE(linearLowerTemp);
 	return ret;
 }
 void Generic6DofSpring2Constraint::LinearLowerLimit::set(Vector3 linearLower)
@@ -773,10 +768,9 @@ void Generic6DofSpring2Constraint::LinearLowerLimit::set(Vector3 linearLower)
 
 Vector3 Generic6DofSpring2Constraint::LinearUpperLimit::get()
 {
-	btVector3* linearUpperTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, linearUpperTemp);
 	Native->getLinearUpperLimit(*linearUpperTemp);
 	Vector3 ret = Math::BtVector3ToVector3(linearUpperTemp);
-	ALIGNED_FREE(linearUpperTemp);
 	return ret;
 }
 void Generic6DofSpring2Constraint::LinearUpperLimit::set(Vector3 linearUpper)
@@ -300,18 +300,18 @@ Matrix HingeConstraint::FrameOffsetA::get()
 void HingeConstraint::FrameOffsetA::set(Matrix value)
 {
 #if defined(BT_USE_SIMD_VECTOR3) && defined(BT_USE_SSE_IN_API) && defined(BT_USE_SSE)
-	btScalar* m = (btScalar*)btAlignedAlloc(sizeof(btScalar) * 16, 16);
-	btTransform* a = Math::MatrixToBtTransform(value);
+	ALIGNED_STACK_STORAGE(m, btScalar[16]);
+	btScalar* m = (btScalar*)ALIGNED_STACK_PTR(m);
+	ALIGNED_STACK(btTransform, a);
+	Math::MatrixToBtTransform(value, a);
 	a->getOpenGLMatrix(m);
 	Native->getFrameOffsetA().setFromOpenGLMatrix(m);
-	btAlignedFree(m);
-	ALIGNED_FREE(a);
 #else
 	btScalar m[16];
-	btTransform* a = Math::MatrixToBtTransform(value);
+	ALIGNED_STACK(btTransform, a);
+	Math::MatrixToBtTransform(value, a);
 	a->getOpenGLMatrix(m);
 	Native->getFrameOffsetA().setFromOpenGLMatrix(m);
-	ALIGNED_FREE(a);
 #endif
 }
 
@@ -322,18 +322,18 @@ Matrix HingeConstraint::FrameOffsetB::get()
 void HingeConstraint::FrameOffsetB::set(Matrix value)
 {
 #if defined(BT_USE_SIMD_VECTOR3) && defined(BT_USE_SSE_IN_API) && defined(BT_USE_SSE)
-	btScalar* m = (btScalar*)btAlignedAlloc(sizeof(btScalar) * 16, 16);
-	btTransform* a = Math::MatrixToBtTransform(value);
+	ALIGNED_STACK_STORAGE(m, btScalar[16]);
+	btScalar* m = (btScalar*)ALIGNED_STACK_PTR(m);
+	ALIGNED_STACK(btTransform, a);
+	Math::MatrixToBtTransform(value, a);
 	a->getOpenGLMatrix(m);
 	Native->getFrameOffsetB().setFromOpenGLMatrix(m);
-	btAlignedFree(m);
-	ALIGNED_FREE(a);
 #else
 	btScalar m[16];
-	btTransform* a = Math::MatrixToBtTransform(value);
+	ALIGNED_STACK(btTransform, a);
+	Math::MatrixToBtTransform(value, a);
 	a->getOpenGLMatrix(m);
 	Native->getFrameOffsetB().setFromOpenGLMatrix(m);
-	ALIGNED_FREE(a);
 #endif
 }
 
@@ -154,14 +154,12 @@ bool btKinematicCharacterController_recoverFromPenetration(btCollisionWorld* col
 
 bool KinematicCharacterController::RecoverFromPenetration(CollisionWorld^ collisionWorld)
 {
-	btVector3* currentPositionTemp = ALIGNED_NEW(btVector3);
-	btVector3* touchingNormalTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, currentPositionTemp);
+	ALIGNED_STACK(btVector3, touchingNormalTemp);
 	bool ret = btKinematicCharacterController_recoverFromPenetration(collisionWorld->_native, (btConvexShape*)_convexShape->_native,
 		(btPairCachingGhostObject*)_ghostObject->_native, currentPositionTemp, touchingNormalTemp);
 	Math::BtVector3ToVector3(currentPositionTemp, _currentPosition);
 	Math::BtVector3ToVector3(touchingNormalTemp, _touchingNormal);
-	ALIGNED_FREE(currentPositionTemp);
-	ALIGNED_FREE(touchingNormalTemp);
 	return ret;
 }
 
@@ -187,9 +185,9 @@ void KinematicCharacterController::StepDown(CollisionWorld^ collisionWorld, btSc
 	Vector3 step_drop = Vector3_Scale(GetUpAxisDirection(_upAxis), _currentStepOffset + downVelocity);
 	_targetPosition -= step_drop;
 
-	btTransform* startTemp = ALIGNED_NEW(btTransform);
-	btTransform* endTemp = ALIGNED_NEW(btTransform);
-	btTransform* endDoubleTemp = ALIGNED_NEW(btTransform);
+	ALIGNED_STACK(btTransform, startTemp);
+	ALIGNED_STACK(btTransform, endTemp);
+	ALIGNED_STACK(btTransform, endDoubleTemp);
 	startTemp->setIdentity();
 	endTemp->setIdentity();
 	endDoubleTemp->setIdentity();
@@ -257,9 +255,6 @@ void KinematicCharacterController::StepDown(CollisionWorld^ collisionWorld, btSc
 		}
 		break;
 	}
-	ALIGNED_FREE(startTemp);
-	ALIGNED_FREE(endTemp);
-	ALIGNED_FREE(endDoubleTemp);
 
 	if (callback->HasHit || runonce)
 	{
@@ -322,8 +317,8 @@ void KinematicCharacterController::StepForwardAndStrafe(CollisionWorld^ collisio
 	btScalar distance2 = Vector3_DistanceSquared(_currentPosition, _targetPosition);
 	int maxIter = 10;
 
-	btTransform* startTemp = ALIGNED_NEW(btTransform);
-	btTransform* endTemp = ALIGNED_NEW(btTransform);
+	ALIGNED_STACK(btTransform, startTemp);
+	ALIGNED_STACK(btTransform, endTemp);
 	startTemp->setIdentity();
 	endTemp->setIdentity();
 
@@ -379,24 +374,20 @@ void KinematicCharacterController::StepForwardAndStrafe(CollisionWorld^ collisio
 		delete callback;
 	}
 
-	ALIGNED_FREE(startTemp);
-	ALIGNED_FREE(endTemp);
 }
 
 void KinematicCharacterController::StepUp(CollisionWorld^ world)
 {
 	_targetPosition = _currentPosition + Vector3_Scale(GetUpAxisDirection(_upAxis), _stepHeight + (_verticalOffset > 0 ? _verticalOffset : 0));
 
-	btTransform* startTemp = ALIGNED_NEW(btTransform);
-	btTransform* endTemp = ALIGNED_NEW(btTransform);
+	ALIGNED_STACK(btTransform, startTemp);
+	ALIGNED_STACK(btTransform, endTemp);
 	startTemp->setIdentity();
 	endTemp->setIdentity();
 	Math::Vector3ToBtVector3(_currentPosition + Vector3_Scale(GetUpAxisDirection(_upAxis), _convexShape->Margin + _addedMargin), &startTemp->getOrigin());
 	Math::Vector3ToBtVector3(_targetPosition, &endTemp->getOrigin());
 	Matrix start = Math::BtTransformToMatrix(startTemp);
 	Matrix end = Math::BtTransformToMatrix(endTemp);
-	ALIGNED_FREE(startTemp);
-	ALIGNED_FREE(endTemp);
 
 	KinematicClosestNotMeConvexResultCallback^ callback = gcnew KinematicClosestNotMeConvexResultCallback(_ghostObject, Vector3_Neg(GetUpAxisDirection(_upAxis)), btScalar(0.7071));
 	BroadphaseProxy^ ghostProxy = GhostObject->BroadphaseHandle;
@@ -516,8 +507,7 @@ void KinematicCharacterController::PlayerStep(CollisionWorld^ collisionWorld, bt
 	}
 	_verticalOffset = _verticalVelocity * dt;
 
-	btTransform* xformTemp = ALIGNED_NEW(btTransform);
-	xformTemp = &_ghostObject->_native->getWorldTransform();
+	btTransform* xformTemp = &_ghostObject->_native->getWorldTransform();
 
 	StepUp(collisionWorld);
 	if (_useWalkDirection) {
@@ -538,7 +528,6 @@ void KinematicCharacterController::PlayerStep(CollisionWorld^ collisionWorld, bt
 	xformTemp->getOrigin().setY(Vector_Y(_currentPosition));
 	xformTemp->getOrigin().setZ(Vector_Z(_currentPosition));
     _ghostObject->_native->setWorldTransform(*xformTemp);
-	ALIGNED_FREE(xformTemp);
 }
 
 void KinematicCharacterController::PreStep(CollisionWorld^ collisionWorld)
@@ -719,14 +708,13 @@ btScalar KinematicClosestNotMeConvexResultCallback::AddSingleResult(LocalConvexR
     else
     {
         // need to transform normal into worldspace
-		btTransform* worldTransformTemp = Math::MatrixToBtTransform(convexResult->HitCollisionObject->WorldTransform);
-		btVector3* hitNormalLocalTemp = Math::Vector3ToBtVector3(convexResult->HitNormalLocal);
-		btVector3* hitNormalWorldTemp = ALIGNED_NEW(btVector3);
+		ALIGNED_STACK(btTransform, worldTransformTemp);
+		Math::MatrixToBtTransform(convexResult->HitCollisionObject->WorldTransform, worldTransformTemp);
+		ALIGNED_STACK(btVector3, hitNormalLocalTemp);
+		Math::Vector3ToBtVector3(convexResult->HitNormalLocal, hitNormalLocalTemp);
+		ALIGNED_STACK(btVector3, hitNormalWorldTemp);
 		KinematicClosestNotMeConvexResultCallback_AddSingleResult_Transform(worldTransformTemp, hitNormalLocalTemp, hitNormalWorldTemp);
 		Math::BtVector3ToVector3(hitNormalWorldTemp, hitNormalWorld);
-		ALIGNED_FREE(worldTransformTemp);
-		ALIGNED_FREE(hitNormalLocalTemp);
-		ALIGNED_FREE(hitNormalWorldTemp);
     }
 
     float dotUp = Vector3_Dot(_up, hitNormalWorld);
@@ -9,28 +9,66 @@ ManifoldPoint::ManifoldPoint(btManifoldPoint* native, bool preventDelete)
 	_preventDelete = preventDelete;
 }
 
-#ifdef BT_CALLBACKS_ARE_EVENTS
 bool onContactAdded(btManifoldPoint& cp, const btCollisionObjectWrapper* colObj0Wrap,
 	int partId0, int index0, const btCollisionObjectWrapper* colObj1Wrap, int partId1, int index1)
 {
-	/*
-	ContactAddedEventArgs^ args = gcnew ContactAddedEventArgs();
-	args->ContactPoint = gcnew ManifoldPoint(&cp, true);
-	args->CollisionObject0Wrapper = gcnew CollisionObjectWrapper((btCollisionObjectWrapper*)colObj0Wrap);
-	args->PartID0 = partId0;
-	args->Index0 = index0;
-	args->CollisionObject1Wrapper = gcnew CollisionObjectWrapper((btCollisionObjectWrapper*)colObj1Wrap);
-	args->PartID1 = partId1;
-	args->Index1 = index1;
-	ManifoldPoint::_contactAdded(nullptr, args);
-	return args->IsContactModified;
-	*/
-	ManifoldPoint::_contactAdded(gcnew ManifoldPoint(&cp, true),
-		gcnew CollisionObjectWrapper((btCollisionObjectWrapper*)colObj0Wrap), partId0, index0,
-		gcnew CollisionObjectWrapper((btCollisionObjectWrapper*)colObj1Wrap), partId1, index1);
-	return false;
+	ManifoldPoint^ point;
+	CollisionObjectWrapper^ wrap0;
+	CollisionObjectWrapper^ wrap1;
+
+	// Reuse the pooled arguments if enabled, unless a handler caused a nested callback
+	bool pooled = ManifoldPoint::_reuseCallbackArgs && !ManifoldPoint::_contactAddedArgsInUse;
+	if (pooled)
+	{
+		if (ManifoldPoint::_contactAddedPoint == nullptr)
+		{
+			ManifoldPoint::_contactAddedPoint = gcnew ManifoldPoint(&cp, true);
+			ManifoldPoint::_contactAddedWrap0 = gcnew CollisionObjectWrapper((btCollisionObjectWrapper*)colObj0Wrap);
+			ManifoldPoint::_contactAddedWrap1 = gcnew CollisionObjectWrapper((btCollisionObjectWrapper*)colObj1Wrap);
+		}
+		point = ManifoldPoint::_contactAddedPoint;
+		wrap0 = ManifoldPoint::_contactAddedWrap0;
+		wrap1 = ManifoldPoint::_contactAddedWrap1;
+		point->_native = &cp;
+		wrap0->_native = (btCollisionObjectWrapper*)colObj0Wrap;
+		wrap1->_native = (btCollisionObjectWrapper*)colObj1Wrap;
+		ManifoldPoint::_contactAddedArgsInUse = true;
+	}
+	else
+	{
+		point = gcnew ManifoldPoint(&cp, true);
+		wrap0 = gcnew CollisionObjectWrapper((btCollisionObjectWrapper*)colObj0Wrap);
+		wrap1 = gcnew CollisionObjectWrapper((btCollisionObjectWrapper*)colObj1Wrap);
+	}
+
+	try
+	{
+#ifdef BT_CALLBACKS_ARE_EVENTS
+		ManifoldPoint::_contactAdded(point, wrap0, partId0, index0, wrap1, partId1, index1);
+		return false;
+#else
+		return ManifoldPoint::_contactAdded(point, wrap0, partId0, index0, wrap1, partId1, index1);
+#endif
+	}
+	finally
+	{
+		if (pooled)
+		{
+			ManifoldPoint::_contactAddedArgsInUse = false;
+		}
+	}
+}
+
+bool ManifoldPoint::ReuseCallbackArgs::get()
+{
+	return _reuseCallbackArgs;
+}
+void ManifoldPoint::ReuseCallbackArgs::set(bool value)
+{
+	_reuseCallbackArgs = value;
 }
 
+#ifdef BT_CALLBACKS_ARE_EVENTS
 void ManifoldPoint::ContactAdded::add(ContactAddedEventHandler^ callback)
 {
 	gContactAddedCallback = onContactAdded;
@@ -45,14 +83,6 @@ void ManifoldPoint::ContactAdded::remove(ContactAddedEventHandler^ callback)
 	}
 }
 #else
-bool onContactAdded(btManifoldPoint& cp, const btCollisionObjectWrapper* colObj0Wrap,
-	int partId0, int index0, const btCollisionObjectWrapper* colObj1Wrap, int partId1, int index1)
-{
-	return ManifoldPoint::_contactAdded(gcnew ManifoldPoint(&cp, true),
-		gcnew CollisionObjectWrapper((btCollisionObjectWrapper*)colObj0Wrap), partId0, index0,
-		gcnew CollisionObjectWrapper((btCollisionObjectWrapper*)colObj1Wrap), partId1, index1);
-}
-
 ContactAdded^ ManifoldPoint::ContactAdded::get()
 {
 	return _contactAdded;
@@ -43,17 +43,39 @@ namespace BulletSharp
 
 	internal:
 		ManifoldPoint(btManifoldPoint* native, bool preventDelete);
+
+		// Arguments reused for every ContactAdded callback if ReuseCallbackArgs is set
+		static ManifoldPoint^ _contactAddedPoint;
+		static CollisionObjectWrapper^ _contactAddedWrap0;
+		static CollisionObjectWrapper^ _contactAddedWrap1;
+		static bool _contactAddedArgsInUse;
+		static bool _reuseCallbackArgs;
+
+	public:
+		// If set, ContactAdded and PersistentManifold.ContactProcessed pass the same argument objects
+		// to every callback instead of allocating new ones. Handlers must then not keep references
+		// to the arguments after returning. Off by default.
+		static property bool ReuseCallbackArgs
+		{
+			bool get();
+			void set(bool value);
+		}
+
 #ifdef BT_CALLBACKS_ARE_EVENTS
+	internal:
 		static ContactAddedEventHandler^ _contactAdded;
 	public:
+		// The arguments are only valid during the callback if ReuseCallbackArgs is set
 		static event ContactAddedEventHandler^ ContactAdded
 		{
 			void add(ContactAddedEventHandler^ callback);
 			void remove(ContactAddedEventHandler^ callback);
 		}
 #else
+	internal:
 		static ContactAdded^ _contactAdded;
 	public:
+		// The arguments are only valid during the callback if ReuseCallbackArgs is set
 		static property ContactAdded^ ContactAdded
 		{
 			::ContactAdded^ get();
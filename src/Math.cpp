@@ -100,6 +100,70 @@ array<Vector3>^ BulletSharp::Math::Vector3ArrayToManaged(btVector3* v, int lengt
 	return vertices;
 }
 
+// Bulk copies between btVector3 arrays with the given byte stride and packed Vector3 arrays.
+// Uses memcpy if the layouts are identical and skips the padding element if Vector3 is three btScalars.
+void BulletSharp::Math::BtVector3ArrayToVector3Array(const btVector3* v, int stride, Vector3* vOut, int length)
+{
+	if (sizeof(btVector3) == sizeof(Vector3) && stride == sizeof(btVector3))
+	{
+		memcpy(vOut, v, length * sizeof(btVector3));
+	}
+	else if (sizeof(Vector3) == 3 * sizeof(btScalar))
+	{
+		const char* p = (const char*)v;
+		btScalar* o = (btScalar*)vOut;
+		for (int i = 0; i < length; i++)
+		{
+			const btScalar* f = (const btScalar*)p;
+			o[0] = f[0];
+			o[1] = f[1];
+			o[2] = f[2];
+			o += 3;
+			p += stride;
+		}
+	}
+	else
+	{
+		const char* p = (const char*)v;
+		for (int i = 0; i < length; i++)
+		{
+			BtVector3ToVector3((const btVector3*)p, vOut[i]);
+			p += stride;
+		}
+	}
+}
+
+void BulletSharp::Math::Vector3ArrayToBtVector3Array(Vector3* v, btVector3* vOut, int stride, int length)
+{
+	if (sizeof(btVector3) == sizeof(Vector3) && stride == sizeof(btVector3))
+	{
+		memcpy(vOut, v, length * sizeof(btVector3));
+	}
+	else if (sizeof(Vector3) == 3 * sizeof(btScalar))
+	{
+		const btScalar* f = (const btScalar*)v;
+		char* p = (char*)vOut;
+		for (int i = 0; i < length; i++)
+		{
+			btScalar* o = (btScalar*)p;
+			o[0] = f[0];
+			o[1] = f[1];
+			o[2] = f[2];
+			f += 3;
+			p += stride;
+		}
+	}
+	else
+	{
+		char* p = (char*)vOut;
+		for (int i = 0; i < length; i++)
+		{
+			Vector3ToBtVector3(v[i], (btVector3*)p);
+			p += stride;
+		}
+	}
+}
+
 btVector4* BulletSharp::Math::Vector4ToBtVector4(Vector4 vector)
 {
 	return new btVector4(Vector_X(vector), Vector_Y(vector), Vector_Z(vector), Vector_W(vector));
@@ -38,21 +38,24 @@ using namespace Mogre;
 // FIXME: is it safe to cast Vector3 to btVector3 given that btVector3 has padding?
 #define VECTOR3_NAME(vec) vec ## Temp
 #define VECTOR4_NAME(vec) vec ## Temp
+// The temporaries live in aligned stack storage (see ALIGNED_STACK), so VECTOR3_DEL does not free anything.
+#define VECTOR3_STACK_CONV(vec) ALIGNED_STACK(btVector3, VECTOR3_NAME(vec)) (Vector_X(vec), Vector_Y(vec), Vector_Z(vec))
+#define VECTOR4_STACK_CONV(vec) ALIGNED_STACK(btVector4, VECTOR4_NAME(vec)) (Vector_X(vec), Vector_Y(vec), Vector_Z(vec), Vector_W(vec))
 #ifdef GRAPHICS_NO_DIRECT_CAST
-#define VECTOR3_CONV(vec) btVector3* VECTOR3_NAME(vec) = Math::Vector3ToBtVector3(vec)
+#define VECTOR3_CONV(vec) VECTOR3_STACK_CONV(vec)
 #define VECTOR3_PTR(vec) VECTOR3_NAME(vec)
-#define VECTOR3_DEL(vec) ALIGNED_FREE(VECTOR3_PTR(vec))
-#define VECTOR4_CONV(vec) btVector4* VECTOR4_NAME(vec) = Math::Vector4ToBtVector4(vec)
+#define VECTOR3_DEL(vec)
+#define VECTOR4_CONV(vec) VECTOR4_STACK_CONV(vec)
 #define VECTOR4_PTR(vec) VECTOR4_NAME(vec)
-#define VECTOR4_DEL(vec) ALIGNED_FREE(VECTOR4_PTR(vec))
+#define VECTOR4_DEL(vec)
 #else
 #define VECTOR3_PTR(vec) ((btVector3*) VECTOR3_NAME(vec))
 #define VECTOR4_PTR(vec) ((btVector4*) VECTOR3_NAME(vec))
 #ifdef BT_USE_SSE_IN_API
-#define VECTOR3_CONV(vec) btVector3* VECTOR3_NAME(vec) = Math::Vector3ToBtVector3(vec)
-#define VECTOR3_DEL(vec) ALIGNED_FREE(VECTOR3_PTR(vec))
-#define VECTOR4_CONV(vec) btVector4* VECTOR4_NAME(vec) = Math::Vector4ToBtVector4(vec)
-#define VECTOR4_DEL(vec) ALIGNED_FREE(VECTOR4_PTR(vec))
+#define VECTOR3_CONV(vec) VECTOR3_STACK_CONV(vec)
+#define VECTOR3_DEL(vec)
+#define VECTOR4_CONV(vec) VECTOR4_STACK_CONV(vec)
+#define VECTOR4_DEL(vec)
 #else
 #define VECTOR3_CONV(vec) pin_ptr<Vector3> VECTOR3_NAME(vec) = &vec
 #define VECTOR3_DEL(vec)
@@ -65,24 +68,24 @@ using namespace Mogre;
 
 #define TRANSFORM_NAME(t) t ## Temp
 #define TRANSFORM_DEF(t) btTransform* TRANSFORM_NAME(t)
-#define TRANSFORM_CONV(t) TRANSFORM_DEF(t) = Math::MatrixToBtTransform(t)
+#define TRANSFORM_CONV(t) ALIGNED_STACK(btTransform, TRANSFORM_NAME(t)); Math::MatrixToBtTransform(t, TRANSFORM_PTR(t))
 #define TRANSFORM_PTR(t) TRANSFORM_NAME(t)
 #define TRANSFORM_USE(t) *TRANSFORM_PTR(t)
-#define TRANSFORM_DEL(t) ALIGNED_FREE(TRANSFORM_PTR(t))
+#define TRANSFORM_DEL(t)
 
 #define MATRIX3X3_NAME(t) t ## Temp
 #define MATRIX3X3_DEF(t) btMatrix3x3* MATRIX3X3_NAME(t)
-#define MATRIX3X3_CONV(t) MATRIX3X3_DEF(t) = Math::MatrixToBtMatrix3x3(t)
+#define MATRIX3X3_CONV(t) ALIGNED_STACK(btMatrix3x3, MATRIX3X3_NAME(t)); Math::MatrixToBtMatrix3x3(t, MATRIX3X3_PTR(t))
 #define MATRIX3X3_PTR(t) MATRIX3X3_NAME(t)
 #define MATRIX3X3_USE(t) *MATRIX3X3_PTR(t)
-#define MATRIX3X3_DEL(t) ALIGNED_FREE(MATRIX3X3_PTR(t))
+#define MATRIX3X3_DEL(t)
 
 #define QUATERNION_NAME(t) t ## Temp
 #define QUATERNION_DEF(t) btQuaternion* QUATERNION_NAME(t)
-#define QUATERNION_CONV(t) QUATERNION_DEF(t) = Math::QuaternionToBtQuat(t)
+#define QUATERNION_CONV(t) ALIGNED_STACK(btQuaternion, QUATERNION_NAME(t)) (Vector_X(t), Vector_Y(t), Vector_Z(t), Vector_W(t))
 #define QUATERNION_PTR(t) QUATERNION_NAME(t)
 #define QUATERNION_USE(t) *QUATERNION_PTR(t)
-#define QUATERNION_DEL(t) ALIGNED_FREE(QUATERNION_PTR(t))
+#define QUATERNION_DEL(t)
 
 #if defined(GRAPHICS_MOGRE) || defined(GRAPHICS_AXIOM)
 #define Vector_X(v) btScalar((v).x)
@@ -139,6 +142,8 @@ namespace BulletSharp
 		static void Vector3ToBtVector3(Vector3%, btVector3*);
 		static btVector3* Vector3ArrayToUnmanaged(array<Vector3>^);
 		static array<Vector3>^ Vector3ArrayToManaged(btVector3*, int);
+		static void BtVector3ArrayToVector3Array(const btVector3*, int, Vector3*, int);
+		static void Vector3ArrayToBtVector3Array(Vector3*, btVector3*, int, int);
 
 		static inline Vector4 BtVector4ToVector4(const btVector4* vector)
 		{
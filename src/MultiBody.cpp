@@ -192,11 +192,10 @@ void MultiBody_LocalDirToWorld(btMultiBody* body, int i, btVector3* vec, btVecto
 Vector3 MultiBody::LocalDirToWorld(int i, Vector3 vec)
 {
 	VECTOR3_CONV(vec);
-	btVector3* resultTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, resultTemp);
 	MultiBody_LocalDirToWorld(_native, i, VECTOR3_PTR(vec), resultTemp);
 	Vector3 dir = Math::BtVector3ToVector3(resultTemp);
 	VECTOR3_DEL(vec);
-	ALIGNED_FREE(resultTemp);
 	return dir;
 }
 
@@ -209,11 +208,10 @@ void MultiBody_LocalPosToWorld(btMultiBody* body, int i, btVector3* vec, btVecto
 Vector3 MultiBody::LocalPosToWorld(int i, Vector3 vec)
 {
 	VECTOR3_CONV(vec);
-	btVector3* resultTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, resultTemp);
 	MultiBody_LocalPosToWorld(_native, i, VECTOR3_PTR(vec), resultTemp);
 	Vector3 dir = Math::BtVector3ToVector3(resultTemp);
 	VECTOR3_DEL(vec);
-	ALIGNED_FREE(resultTemp);
 	return dir;
 }
 
@@ -418,11 +416,10 @@ void MultiBody_WorldDirToLocal(btMultiBody* body, int i, btVector3* vec, btVecto
 Vector3 MultiBody::WorldDirToLocal(int i, Vector3 vec)
 {
 	VECTOR3_CONV(vec);
-	btVector3* resultTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, resultTemp);
 	MultiBody_WorldDirToLocal(_native, i, VECTOR3_PTR(vec), resultTemp);
 	Vector3 dir = Math::BtVector3ToVector3(resultTemp);
 	VECTOR3_DEL(vec);
-	ALIGNED_FREE(resultTemp);
 	return dir;
 }
 
@@ -435,11 +432,10 @@ void MultiBody_WorldPosToLocal(btMultiBody* body, int i, btVector3* vec, btVecto
 Vector3 MultiBody::WorldPosToLocal(int i, Vector3 vec)
 {
 	VECTOR3_CONV(vec);
-	btVector3* resultTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, resultTemp);
 	MultiBody_WorldPosToLocal(_native, i, VECTOR3_PTR(vec), resultTemp);
 	Vector3 dir = Math::BtVector3ToVector3(resultTemp);
 	VECTOR3_DEL(vec);
-	ALIGNED_FREE(resultTemp);
 	return dir;
 }
 
@@ -460,10 +456,9 @@ void MultiBody_GetAngularMomentum(btMultiBody* body, btVector3* result)
 #pragma managed(pop)
 Vector3 MultiBody::AngularMomentum::get()
 {
-	btVector3* valueTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, valueTemp);
 	MultiBody_GetAngularMomentum(_native, valueTemp);
 	Vector3 value = Math::BtVector3ToVector3(valueTemp);
-	ALIGNED_FREE(valueTemp);
 	return value;
 }
 
@@ -509,10 +504,9 @@ void MultiBody_GetBaseOmega(btMultiBody* body, btVector3* result)
 #pragma managed(pop)
 Vector3 MultiBody::BaseOmega::get()
 {
-	btVector3* valueTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, valueTemp);
 	MultiBody_GetBaseOmega(_native, valueTemp);
 	Vector3 value = Math::BtVector3ToVector3(valueTemp);
-	ALIGNED_FREE(valueTemp);
 	return value;
 }
 void MultiBody::BaseOmega::set(Vector3 omega)
@@ -546,10 +540,9 @@ void MultiBody_GetBaseVel(btMultiBody* body, btVector3* result)
 #pragma managed(pop)
 Vector3 MultiBody::BaseVelocity::get()
 {
-	btVector3* valueTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, valueTemp);
 	MultiBody_GetBaseVel(_native, valueTemp);
 	Vector3 value = Math::BtVector3ToVector3(valueTemp);
-	ALIGNED_FREE(valueTemp);
 	return value;
 }
 void MultiBody::BaseVelocity::set(Vector3 vel)
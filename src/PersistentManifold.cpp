@@ -9,6 +9,48 @@ PersistentManifold::PersistentManifold(btPersistentManifold* native)
 	_native = native;
 }
 
+bool onContactProcessed(btManifoldPoint& cp, void* body0, void* body1)
+{
+	ManifoldPoint^ point;
+	bool pooled = ManifoldPoint::_reuseCallbackArgs && !PersistentManifold::_contactProcessedPointInUse;
+	if (pooled)
+	{
+		point = PersistentManifold::_contactProcessedPoint;
+		if (point == nullptr)
+		{
+			point = gcnew ManifoldPoint(&cp, true);
+			PersistentManifold::_contactProcessedPoint = point;
+		}
+		point->_native = &cp;
+		PersistentManifold::_contactProcessedPointInUse = true;
+	}
+	else
+	{
+		point = gcnew ManifoldPoint(&cp, true);
+	}
+
+	try
+	{
+#ifdef BT_CALLBACKS_ARE_EVENTS
+		PersistentManifold::_contactProcessed(point,
+			CollisionObject::GetManaged((btCollisionObject*)body0),
+			CollisionObject::GetManaged((btCollisionObject*)body1));
+		return false;
+#else
+		return PersistentManifold::_contactProcessed(point,
+			CollisionObject::GetManaged((btCollisionObject*)body0),
+			CollisionObject::GetManaged((btCollisionObject*)body1));
+#endif
+	}
+	finally
+	{
+		if (pooled)
+		{
+			PersistentManifold::_contactProcessedPointInUse = false;
+		}
+	}
+}
+
 #ifdef BT_CALLBACKS_ARE_EVENTS
 bool onContactDestroyed(void* userPersistentData)
 {
@@ -17,14 +59,6 @@ bool onContactDestroyed(void* userPersistentData)
 	return false;
 }
 
-bool onContactProcessed(btManifoldPoint& cp, void* body0, void* body1)
-{
-	PersistentManifold::_contactProcessed(gcnew ManifoldPoint(&cp, true),
-		CollisionObject::GetManaged((btCollisionObject*)body0),
-		CollisionObject::GetManaged((btCollisionObject*)body1));
-	return false;
-}
-
 void PersistentManifold::ContactDestroyed::add(ContactDestroyedEventHandler^ callback)
 {
 	gContactDestroyedCallback = onContactDestroyed;
@@ -60,13 +94,6 @@ bool onContactDestroyed(void* userPersistentData)
 	return ret;
 }
 
-bool onContactProcessed(btManifoldPoint& cp, void* body0, void* body1)
-{
-	return PersistentManifold::_contactProcessed(gcnew ManifoldPoint(&cp, true),
-		CollisionObject::GetManaged((btCollisionObject*)body0),
-		CollisionObject::GetManaged((btCollisionObject*)body1));
-}
-
 ContactDestroyed^ PersistentManifold::ContactDestroyed::get()
 {
 	return _contactDestroyed;
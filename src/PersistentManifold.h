@@ -20,6 +20,10 @@ namespace BulletSharp
 
 		PersistentManifold(btPersistentManifold* native);
 
+		// Reused for every ContactProcessed callback if ManifoldPoint.ReuseCallbackArgs is set
+		static ManifoldPoint^ _contactProcessedPoint;
+		static bool _contactProcessedPointInUse;
+
 #ifdef BT_CALLBACKS_ARE_EVENTS
 		static ContactDestroyedEventHandler^ _contactDestroyed;
 		static ContactProcessedEventHandler^ _contactProcessed;
@@ -30,6 +34,7 @@ namespace BulletSharp
 			void add(ContactDestroyedEventHandler^ callback);
 			void remove(ContactDestroyedEventHandler^ callback);
 		}
+		// The point is only valid during the callback if ManifoldPoint.ReuseCallbackArgs is set
 		static event ContactProcessedEventHandler^ ContactProcessed
 		{
 			void add(ContactProcessedEventHandler^ callback);
@@ -46,6 +51,7 @@ namespace BulletSharp
 			void set(::ContactDestroyed^ value);
 		}
 
+		// The point is only valid during the callback if ManifoldPoint.ReuseCallbackArgs is set
 		static property ContactProcessed^ ContactProcessed
 		{
 			::ContactProcessed^ get();
@@ -14,40 +14,35 @@ PolyhedralConvexShape::PolyhedralConvexShape(btPolyhedralConvexShape* native)
 
 void PolyhedralConvexShape::GetEdge(int index, [Out] Vector3% pointA, [Out] Vector3% pointB)
 {
-	btVector3* paTemp = ALIGNED_NEW(btVector3);
-	btVector3* pbTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, paTemp);
+	ALIGNED_STACK(btVector3, pbTemp);
 
 	Native->getEdge(index, *paTemp, *pbTemp);
 
 	Math::BtVector3ToVector3(paTemp, pointA);
 	Math::BtVector3ToVector3(pbTemp, pointB);
 
-	ALIGNED_FREE(paTemp);
-	ALIGNED_FREE(pbTemp);
 }
 
 void PolyhedralConvexShape::GetPlane([Out] Vector3% planeNormal, [Out] Vector3% planeSupport, int index)
 {
-	btVector3* planeNormalTemp = ALIGNED_NEW(btVector3);
-	btVector3* planeSupportTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, planeNormalTemp);
+	ALIGNED_STACK(btVector3, planeSupportTemp);
 
 	Native->getPlane(*planeNormalTemp, *planeSupportTemp, index);
 
 	Math::BtVector3ToVector3(planeNormalTemp, planeNormal);
 	Math::BtVector3ToVector3(planeSupportTemp, planeSupport);
 
-	ALIGNED_FREE(planeNormalTemp);
-	ALIGNED_FREE(planeSupportTemp);
 }
 
 void PolyhedralConvexShape::GetVertex(int index, [Out] Vector3% vertex)
 {
-	btVector3* vtxTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, vtxTemp);
 
 	Native->getVertex(index, *vtxTemp);
 
 	Math::BtVector3ToVector3(vtxTemp, vertex);
-	ALIGNED_FREE(vtxTemp);
 }
 
 bool PolyhedralConvexShape::InitializePolyhedralFeatures(int shiftVerticesByMargin)
@@ -104,15 +99,13 @@ void PolyhedralConvexAabbCachingShape::GetNonvirtualAabb(Matrix trans, [Out] Vec
 	[Out] Vector3% aabbMax, btScalar margin)
 {
 	TRANSFORM_CONV(trans);
-	btVector3* aabbMinTemp = ALIGNED_NEW(btVector3);
-	btVector3* aabbMaxTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, aabbMinTemp);
+	ALIGNED_STACK(btVector3, aabbMaxTemp);
 	Native->getNonvirtualAabb(TRANSFORM_USE(trans), *aabbMinTemp, *aabbMinTemp,
 		margin);
 	TRANSFORM_DEL(trans);
 	Math::BtVector3ToVector3(aabbMinTemp, aabbMin);
 	Math::BtVector3ToVector3(aabbMaxTemp, aabbMax);
-	ALIGNED_FREE(aabbMinTemp);
-	ALIGNED_FREE(aabbMaxTemp);
 }
 
 void PolyhedralConvexAabbCachingShape::RecalcLocalAabb()
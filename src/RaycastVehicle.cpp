@@ -145,9 +145,10 @@ void RaycastVehicle_GetBasisAxle(const btTransform* transform, int axis, btVecto
 #ifndef DISABLE_DEBUGDRAW
 void RaycastVehicle::DebugDraw(IDebugDraw^ debugDrawer)
 {
-	btVector3& wheelColor = *ALIGNED_NEW(btVector3);
-	btTransform* worldTransformTemp = ALIGNED_NEW(btTransform);
-	btVector3* axleTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, wheelColorTemp);
+	btVector3& wheelColor = *wheelColorTemp;
+	ALIGNED_STACK(btTransform, worldTransformTemp);
+	ALIGNED_STACK(btVector3, axleTemp);
 
 	for (int v = 0; v < NumWheels; v++)
 	{
@@ -171,9 +172,6 @@ void RaycastVehicle::DebugDraw(IDebugDraw^ debugDrawer)
 		debugDrawer->DrawLine(wheelPosWS, wheelPosWS + axle, BtVectorToBtColor(wheelColor));
 		debugDrawer->DrawLine(wheelPosWS, wheel->RaycastInfo.ContactPointWS, BtVectorToBtColor(wheelColor));
 	}
-	ALIGNED_FREE(wheelColor);
-	ALIGNED_FREE(worldTransformTemp);
-	ALIGNED_FREE(axleTemp);
 }
 #endif
 
@@ -369,9 +367,9 @@ void RaycastVehicle::UpdateFriction(btScalar timeStep)
 		_forwardImpulse[i] = btScalar(0.);
 	}
 
-	btTransform* wheelTransTemp = ALIGNED_NEW(btTransform);
-	btVector3* contactPointWSTemp = ALIGNED_NEW(btVector3);
-	btVector3* axleTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btTransform, wheelTransTemp);
+	ALIGNED_STACK(btVector3, contactPointWSTemp);
+	ALIGNED_STACK(btVector3, axleTemp);
 	for (i = 0; i < numWheel; i++)
 	{
 		BulletSharp::WheelInfo^ wheelInfo = _wheelInfo[i];
@@ -403,9 +401,6 @@ void RaycastVehicle::UpdateFriction(btScalar timeStep)
 			_sideImpulse[i] *= sideFrictionStiffness2;
 		}
 	}
-	ALIGNED_FREE(wheelTransTemp);
-	ALIGNED_FREE(contactPointWSTemp);
-	ALIGNED_FREE(axleTemp);
 
 	btScalar sideFactor = btScalar(1.);
 	btScalar fwdFactor = 0.5;
@@ -501,10 +496,9 @@ void RaycastVehicle::UpdateFriction(btScalar timeStep)
 			Vector3 sideImp = Vector3_Scale(_axle[i], _sideImpulse[i]);
 
 #if defined ROLLING_INFLUENCE_FIX // fix. It only worked if car's up was along Y - VT.
-			btVector3* chassisWorldUpTemp = ALIGNED_NEW(btVector3);
+			ALIGNED_STACK(btVector3, chassisWorldUpTemp);
 			RaycastVehicle_GetBasisAxle(&static_cast<btRigidBody*>(RigidBody->_native)->getCenterOfMassTransform(), _indexUpAxis, chassisWorldUpTemp);
 			Vector3 chassisWorldUp = Math::BtVector3ToVector3(chassisWorldUpTemp);
-			ALIGNED_FREE(chassisWorldUpTemp);
 			rel_pos -= Vector3_Scale(chassisWorldUp, Vector3_Dot(chassisWorldUp, rel_pos) * (1.f-wheelInfo->RollInfluence));
 #else
 #if defined(GRAPHICS_MONOGAME) || defined(GRAPHICS_WAPICODEPACK)
@@ -603,14 +597,13 @@ void RaycastVehicle::UpdateVehicle(btScalar step)
 		UpdateWheelTransform(i, false);
 	}
 
-	btVector3* linearVelocityTemp = Math::Vector3ToBtVector3(RigidBody->LinearVelocity);
-	btTransform* chassisTransTemp = Math::MatrixToBtTransform(ChassisWorldTransform);
-	btVector3* forwardWTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, linearVelocityTemp);
+	Math::Vector3ToBtVector3(RigidBody->LinearVelocity, linearVelocityTemp);
+	ALIGNED_STACK(btTransform, chassisTransTemp);
+	Math::MatrixToBtTransform(ChassisWorldTransform, chassisTransTemp);
+	ALIGNED_STACK(btVector3, forwardWTemp);
 	RaycastVehicle_GetBasisAxle(chassisTransTemp, _indexForwardAxis, forwardWTemp);
 	_currentVehicleSpeedKmHour = btScalar(3.6) * RaycastVehicle_UpdateVehicle_GetSpeed(linearVelocityTemp, forwardWTemp);
-	ALIGNED_FREE(linearVelocityTemp);
-	ALIGNED_FREE(chassisTransTemp);
-	ALIGNED_FREE(forwardWTemp);
 
 	for (i = 0; i < numWheels; i++)
 	{
@@ -634,7 +627,7 @@ void RaycastVehicle::UpdateVehicle(btScalar step)
 
 	UpdateFriction(step);
 
-	btVector3* fwdTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, fwdTemp);
 	for (i = 0; i < numWheels; i++)
 	{
 		BulletSharp::WheelInfo^ wheel = _wheelInfo[i];
@@ -660,7 +653,6 @@ void RaycastVehicle::UpdateVehicle(btScalar step)
 
 		wheel->DeltaRotation *= btScalar(0.99);//damping of rotation when not in contact
 	}
-	ALIGNED_FREE(fwdTemp);
 }
 
 #pragma managed(push, off)
@@ -695,17 +687,16 @@ void RaycastVehicle::UpdateWheelTransform(int wheelIndex, bool interpolatedTrans
 	BulletSharp::WheelInfo^ wheel = _wheelInfo[wheelIndex];
 	UpdateWheelTransformsWS(wheel, interpolatedTransform);
 
-	btVector3* wheelDirectionWSTemp = Math::Vector3ToBtVector3(wheel->RaycastInfo.WheelDirectionWS);
-	btVector3* wheelAxleWSTemp = Math::Vector3ToBtVector3(wheel->RaycastInfo.WheelAxleWS);
-	btVector3* hardPointWSTemp = Math::Vector3ToBtVector3(wheel->RaycastInfo.HardPointWS);
-	btTransform* worldTransformTemp = ALIGNED_NEW(btTransform);
+	ALIGNED_STACK(btVector3, wheelDirectionWSTemp);
+	Math::Vector3ToBtVector3(wheel->RaycastInfo.WheelDirectionWS, wheelDirectionWSTemp);
+	ALIGNED_STACK(btVector3, wheelAxleWSTemp);
+	Math::Vector3ToBtVector3(wheel->RaycastInfo.WheelAxleWS, wheelAxleWSTemp);
+	ALIGNED_STACK(btVector3, hardPointWSTemp);
+	Math::Vector3ToBtVector3(wheel->RaycastInfo.HardPointWS, hardPointWSTemp);
+	ALIGNED_STACK(btTransform, worldTransformTemp);
 	RaycastVehicle_UpdateWheelTransform(wheelDirectionWSTemp, wheelAxleWSTemp,
 		wheel->Steering, wheel->Rotation, hardPointWSTemp, wheel->RaycastInfo.SuspensionLength, worldTransformTemp);
 	wheel->WorldTransform = Math::BtTransformToMatrix(worldTransformTemp);
-	ALIGNED_FREE(wheelDirectionWSTemp);
-	ALIGNED_FREE(wheelAxleWSTemp);
-	ALIGNED_FREE(hardPointWSTemp);
-	ALIGNED_FREE(worldTransformTemp);
 }
 
 void RaycastVehicle::UpdateWheelTransform(int wheelIndex)
@@ -735,12 +726,15 @@ void RaycastVehicle::UpdateWheelTransformsWS(BulletSharp::WheelInfo^ wheel, bool
 	}
 
 	TRANSFORM_CONV(chassisTrans);
-	btVector3* chassisConnectionPointCSTemp = Math::Vector3ToBtVector3(wheel->ChassisConnectionPointCS);
-	btVector3* wheelDirectionCSTemp = Math::Vector3ToBtVector3(wheel->WheelDirectionCS);
-	btVector3* wheelAxleCSTemp = Math::Vector3ToBtVector3(wheel->WheelAxleCS);
-	btVector3* hardPointWS = ALIGNED_NEW(btVector3);
-	btVector3* wheelDirectionWS = ALIGNED_NEW(btVector3);
-	btVector3* wheelAxleWS = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, chassisConnectionPointCSTemp);
+	Math::Vector3ToBtVector3(wheel->ChassisConnectionPointCS, chassisConnectionPointCSTemp);
+	ALIGNED_STACK(btVector3, wheelDirectionCSTemp);
+	Math::Vector3ToBtVector3(wheel->WheelDirectionCS, wheelDirectionCSTemp);
+	ALIGNED_STACK(btVector3, wheelAxleCSTemp);
+	Math::Vector3ToBtVector3(wheel->WheelAxleCS, wheelAxleCSTemp);
+	ALIGNED_STACK(btVector3, hardPointWS);
+	ALIGNED_STACK(btVector3, wheelDirectionWS);
+	ALIGNED_STACK(btVector3, wheelAxleWS);
 	RaycastVehicle_UpdateWheelTransformsWS(TRANSFORM_PTR(chassisTrans),
 		chassisConnectionPointCSTemp, hardPointWS,
 		wheelDirectionCSTemp, wheelDirectionWS,
@@ -749,12 +743,6 @@ void RaycastVehicle::UpdateWheelTransformsWS(BulletSharp::WheelInfo^ wheel, bool
 	Math::BtVector3ToVector3(wheelDirectionWS, wheel->RaycastInfo.WheelDirectionWS);
 	Math::BtVector3ToVector3(wheelAxleWS, wheel->RaycastInfo.WheelAxleWS);
 	TRANSFORM_DEL(chassisTrans);
-	ALIGNED_FREE(chassisConnectionPointCSTemp);
-	ALIGNED_FREE(wheelDirectionCSTemp);
-	ALIGNED_FREE(wheelAxleCSTemp);
-	ALIGNED_FREE(hardPointWS);
-	ALIGNED_FREE(wheelDirectionWS);
-	ALIGNED_FREE(wheelAxleWS);
 }
 
 void RaycastVehicle::UpdateWheelTransformsWS(BulletSharp::WheelInfo^ wheel)
@@ -779,12 +767,11 @@ int RaycastVehicle::ForwardAxis::get()
 
 Vector3 RaycastVehicle::ForwardVector::get()
 {
-	btTransform* chassisTransTemp = Math::MatrixToBtTransform(ChassisWorldTransform);
-	btVector3* forwardVectorTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btTransform, chassisTransTemp);
+	Math::MatrixToBtTransform(ChassisWorldTransform, chassisTransTemp);
+	ALIGNED_STACK(btVector3, forwardVectorTemp);
 	RaycastVehicle_GetBasisAxle(chassisTransTemp, _indexForwardAxis, forwardVectorTemp);
 	Vector3 forwardVector = Math::BtVector3ToVector3(forwardVectorTemp);
-	ALIGNED_FREE(chassisTransTemp);
-	ALIGNED_FREE(forwardVectorTemp);
 	return forwardVector;
 }
 
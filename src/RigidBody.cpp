@@ -39,10 +39,9 @@ btRigidBody::btRigidBodyConstructionInfo* RigidBody_GetUnmanagedConstructionInfo
 RigidBodyConstructionInfo::RigidBodyConstructionInfo(btScalar mass, BulletSharp::MotionState^ motionState, BulletSharp::CollisionShape^ collisionShape)
 {
 #ifdef BT_USE_SSE_IN_API
-	btVector3* localInertia = ALIGNED_NEW(btVector3) (0,0,0); // default localInertia parameter is not aligned
+	ALIGNED_STACK(btVector3, localInertia) (0,0,0); // default localInertia parameter is not aligned
 	_native = RigidBody_GetUnmanagedConstructionInfoLocalInertia(mass,
 		GetUnmanagedNullable(motionState), GetUnmanagedNullable(collisionShape), localInertia);
-	ALIGNED_FREE(localInertia);
 #else
 	_native = RigidBody_GetUnmanagedConstructionInfo(mass,
 		GetUnmanagedNullable(motionState), GetUnmanagedNullable(collisionShape));
@@ -290,6 +289,144 @@ void RigidBody::ApplyTorqueImpulse(Vector3 torque)
 	VECTOR3_DEL(torque);
 }
 
+enum RigidBodyBatchOperation
+{
+	ApplyCentralForceOperation,
+	ApplyCentralImpulseOperation,
+	ApplyForceOperation,
+	ApplyImpulseOperation,
+	ApplyTorqueOperation,
+	ApplyTorqueImpulseOperation,
+	SetAngularVelocityOperation,
+	SetLinearVelocityOperation
+};
+
+#pragma managed(push, off)
+void RigidBody_ApplyBatch(btRigidBody** bodies, const btVector3* values, const btVector3* relativePositions,
+	int count, int operation)
+{
+	int i;
+	switch (operation)
+	{
+	case ApplyCentralForceOperation:
+		for (i = 0; i < count; i++)
+			bodies[i]->applyCentralForce(values[i]);
+		break;
+	case ApplyCentralImpulseOperation:
+		for (i = 0; i < count; i++)
+			bodies[i]->applyCentralImpulse(values[i]);
+		break;
+	case ApplyForceOperation:
+		for (i = 0; i < count; i++)
+			bodies[i]->applyForce(values[i], relativePositions[i]);
+		break;
+	case ApplyImpulseOperation:
+		for (i = 0; i < count; i++)
+			bodies[i]->applyImpulse(values[i], relativePositions[i]);
+		break;
+	case ApplyTorqueOperation:
+		for (i = 0; i < count; i++)
+			bodies[i]->applyTorque(values[i]);
+		break;
+	case ApplyTorqueImpulseOperation:
+		for (i = 0; i < count; i++)
+			bodies[i]->applyTorqueImpulse(values[i]);
+		break;
+	case SetAngularVelocityOperation:
+		for (i = 0; i < count; i++)
+			bodies[i]->setAngularVelocity(values[i]);
+		break;
+	case SetLinearVelocityOperation:
+		for (i = 0; i < count; i++)
+			bodies[i]->setLinearVelocity(values[i]);
+		break;
+	}
+}
+#pragma managed(pop)
+
+void RigidBody::ApplyBatch(array<RigidBody^>^ bodies, array<Vector3>^ values,
+	array<Vector3>^ relativePositions, int operation)
+{
+	if (bodies == nullptr)
+		throw gcnew ArgumentNullException("bodies");
+	if (values == nullptr)
+		throw gcnew ArgumentNullException("values");
+
+	int count = bodies->Length;
+	if (values->Length < count)
+		throw gcnew ArgumentException("Array too small.", "values");
+	if (relativePositions != nullptr && relativePositions->Length < count)
+		throw gcnew ArgumentException("Array too small.", "relativePositions");
+	if (count == 0)
+		return;
+
+	btRigidBody** bodiesTemp = new btRigidBody*[count];
+	for (int i = 0; i < count; i++)
+	{
+		RigidBody^ body = bodies[i];
+		if (body == nullptr)
+		{
+			delete[] bodiesTemp;
+			throw gcnew ArgumentNullException("bodies");
+		}
+		bodiesTemp[i] = static_cast<btRigidBody*>(body->_native);
+	}
+
+	btVector3* valuesTemp = Math::Vector3ArrayToUnmanaged(values);
+	btVector3* relativePositionsTemp = relativePositions ? Math::Vector3ArrayToUnmanaged(relativePositions) : 0;
+
+	RigidBody_ApplyBatch(bodiesTemp, valuesTemp, relativePositionsTemp, count, operation);
+
+	delete[] bodiesTemp;
+	delete[] valuesTemp;
+	if (relativePositionsTemp)
+		delete[] relativePositionsTemp;
+}
+
+void RigidBody::ApplyCentralForces(array<RigidBody^>^ bodies, array<Vector3>^ forces)
+{
+	ApplyBatch(bodies, forces, nullptr, ApplyCentralForceOperation);
+}
+
+void RigidBody::ApplyCentralImpulses(array<RigidBody^>^ bodies, array<Vector3>^ impulses)
+{
+	ApplyBatch(bodies, impulses, nullptr, ApplyCentralImpulseOperation);
+}
+
+void RigidBody::ApplyForces(array<RigidBody^>^ bodies, array<Vector3>^ forces, array<Vector3>^ relativePositions)
+{
+	if (relativePositions == nullptr)
+		throw gcnew ArgumentNullException("relativePositions");
+	ApplyBatch(bodies, forces, relativePositions, ApplyForceOperation);
+}
+
+void RigidBody::ApplyImpulses(array<RigidBody^>^ bodies, array<Vector3>^ impulses, array<Vector3>^ relativePositions)
+{
+	if (relativePositions == nullptr)
+		throw gcnew ArgumentNullException("relativePositions");
+	ApplyBatch(bodies, impulses, relativePositions, ApplyImpulseOperation);
+}
+
+void RigidBody::ApplyTorques(array<RigidBody^>^ bodies, array<Vector3>^ torques)
+{
+	ApplyBatch(bodies, torques, nullptr, ApplyTorqueOperation);
+}
+
+void RigidBody::ApplyTorqueImpulses(array<RigidBody^>^ bodies, array<Vector3>^ torques)
+{
+	ApplyBatch(bodies, torques, nullptr, ApplyTorqueImpulseOperation);
+}
+
+void RigidBody::SetAngularVelocities(array<RigidBody^>^ bodies, array<Vector3>^ angularVelocities)
+{
+	ApplyBatch(bodies, angularVelocities, nullptr, SetAngularVelocityOperation);
+}
+
+void RigidBody::SetLinearVelocities(array<RigidBody^>^ bodies, array<Vector3>^ linearVelocities)
+{
+	ApplyBatch(bodies, linearVelocities, nullptr, SetLinearVelocityOperation);
+}
+
 void RigidBody::ClearForces()
 {
 	Native->clearForces();
@@ -311,10 +448,9 @@ void RigidBody_ComputeGyroscopicForceExplicit(btRigidBody* body, btVector3* ret,
 #pragma managed(pop)
 Vector3 RigidBody::ComputeGyroscopicForceExplicit(btScalar maxGyroscopicForce)
 {
-	btVector3* retTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, retTemp);
 	RigidBody_ComputeGyroscopicForceExplicit(Native, retTemp, maxGyroscopicForce);
 	Vector3 ret = Math::BtVector3ToVector3(retTemp);
-	ALIGNED_FREE(retTemp);
 	return ret;
 }
 
@@ -326,10 +462,9 @@ void RigidBody_ComputeGyroscopicImpulseImplicit_Body(btRigidBody* body, btVector
 #pragma managed(pop)
 Vector3 RigidBody::ComputeGyroscopicImpulseImplicitBody(btScalar step)
 {
-	btVector3* retTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, retTemp);
 	RigidBody_ComputeGyroscopicImpulseImplicit_Body(Native, retTemp, step);
 	Vector3 ret = Math::BtVector3ToVector3(retTemp);
-	ALIGNED_FREE(retTemp);
 	return ret;
 }
 
@@ -341,10 +476,9 @@ void RigidBody_ComputeGyroscopicImpulseImplicit_World(btRigidBody* body, btVecto
 #pragma managed(pop)
 Vector3 RigidBody::ComputeGyroscopicImpulseImplicitWorld(btScalar dt)
 {
-	btVector3* retTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, retTemp);
 	RigidBody_ComputeGyroscopicImpulseImplicit_World(Native, retTemp, dt);
 	Vector3 ret = Math::BtVector3ToVector3(retTemp);
-	ALIGNED_FREE(retTemp);
 	return ret;
 }
 
@@ -360,16 +494,14 @@ btScalar RigidBody::ComputeImpulseDenominator(Vector3 pos, Vector3 normal)
 
 void RigidBody::GetAabb([Out] Vector3% aabbMin, [Out] Vector3% aabbMax)
 {
-	btVector3* aabbMinTemp = ALIGNED_NEW(btVector3);
-	btVector3* aabbMaxTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, aabbMinTemp);
+	ALIGNED_STACK(btVector3, aabbMaxTemp);
 
 	Native->getAabb(*aabbMinTemp, *aabbMaxTemp);
 
 	Math::BtVector3ToVector3(aabbMinTemp, aabbMin);
 	Math::BtVector3ToVector3(aabbMaxTemp, aabbMax);
 
-	ALIGNED_FREE(aabbMinTemp);
-	ALIGNED_FREE(aabbMaxTemp);
 }
 
 #ifndef DISABLE_CONSTRAINTS
@@ -388,13 +520,12 @@ void RigidBody_GetVelocityInLocalPoint(btRigidBody* body, btVector3* velocity, b
 Vector3 RigidBody::GetVelocityInLocalPoint(Vector3 relativePosition)
 {
 	VECTOR3_CONV(relativePosition);
-	btVector3* velocityTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, velocityTemp);
 
 	RigidBody_GetVelocityInLocalPoint(Native, velocityTemp, VECTOR3_PTR(relativePosition));
 	Vector3 velocity = Math::BtVector3ToVector3(velocityTemp);
 
 	VECTOR3_DEL(relativePosition);
-	ALIGNED_FREE(velocityTemp);
 
 	return velocity;
 }
@@ -406,10 +537,9 @@ void RigidBody::IntegrateVelocities(btScalar step)
 
 void RigidBody::PredictIntegratedTransform(btScalar step, [Out] Matrix% predictedTransform)
 {
-	btTransform* predictedTransformTemp = ALIGNED_NEW(btTransform);
+	ALIGNED_STACK(btTransform, predictedTransformTemp);
 	Native->predictIntegratedTransform(step, *predictedTransformTemp);
 	Math::BtTransformToMatrix(predictedTransformTemp, predictedTransform);
-	ALIGNED_FREE(predictedTransformTemp);
 }
 
 void RigidBody::ProceedToTransform(Matrix newTrans)
@@ -632,10 +762,9 @@ void RigidBody_GetLocalInertia(btRigidBody* body, btVector3* ret)
 #pragma managed(pop)
 Vector3 RigidBody::LocalInertia::get()
 {
-	btVector3* retTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, retTemp);
 	RigidBody_GetLocalInertia(Native, retTemp);
 	Vector3 ret = Math::BtVector3ToVector3(retTemp);
-	ALIGNED_FREE(retTemp);
 	return ret;
 }
 
@@ -663,10 +792,9 @@ void RigidBody_GetOrientation(btRigidBody* body, btQuaternion* orientation)
 #pragma managed(pop)
 Quaternion RigidBody::Orientation::get()
 {
-	btQuaternion* orientationTemp = ALIGNED_NEW(btQuaternion);
+	ALIGNED_STACK(btQuaternion, orientationTemp);
 	RigidBody_GetOrientation(Native, orientationTemp);
 	Quaternion orientation = Math::BtQuatToQuaternion(orientationTemp);
-	ALIGNED_FREE(orientationTemp);
 	return orientation;
 }
 
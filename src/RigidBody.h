@@ -135,6 +135,9 @@ namespace BulletSharp
 	private:
 		MotionState^ _motionState;
 
+		static void ApplyBatch(array<RigidBody^>^ bodies, array<Vector3>^ values,
+			array<Vector3>^ relativePositions, int operation);
+
 	public:
 		RigidBody(RigidBodyConstructionInfo^ constructionInfo);
 
@@ -149,6 +152,18 @@ namespace BulletSharp
 		void ApplyImpulse(Vector3 impulse, Vector3 relativePosition);
 		void ApplyTorque(Vector3 torque);
 		void ApplyTorqueImpulse(Vector3 torque);
+
+		// Batched versions of the methods above. Element i of each array is applied to bodies[i].
+		// The whole batch is converted once and applied in a single native loop.
+		static void ApplyCentralForces(array<RigidBody^>^ bodies, array<Vector3>^ forces);
+		static void ApplyCentralImpulses(array<RigidBody^>^ bodies, array<Vector3>^ impulses);
+		static void ApplyForces(array<RigidBody^>^ bodies, array<Vector3>^ forces, array<Vector3>^ relativePositions);
+		static void ApplyImpulses(array<RigidBody^>^ bodies, array<Vector3>^ impulses, array<Vector3>^ relativePositions);
+		static void ApplyTorques(array<RigidBody^>^ bodies, array<Vector3>^ torques);
+		static void ApplyTorqueImpulses(array<RigidBody^>^ bodies, array<Vector3>^ torques);
+		static void SetAngularVelocities(array<RigidBody^>^ bodies, array<Vector3>^ angularVelocities);
+		static void SetLinearVelocities(array<RigidBody^>^ bodies, array<Vector3>^ linearVelocities);
+
 		void ClearForces();
 		btScalar ComputeAngularImpulseDenominator(Vector3 axis);
 		Vector3 ComputeGyroscopicForceExplicit(btScalar maxGyroscopicForce);
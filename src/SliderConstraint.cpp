@@ -92,10 +92,9 @@ void SliderConstraint_GetAnchorInA(btSliderConstraint* constraint, btVector3* an
 #pragma managed(pop)
 Vector3 SliderConstraint::AnchorInA::get()
 {
-	btVector3* anchorInATemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, anchorInATemp);
 	SliderConstraint_GetAnchorInA(Native, anchorInATemp);
 	Vector3 anchor = Math::BtVector3ToVector3(anchorInATemp);
-	ALIGNED_FREE(anchorInATemp);
 	return anchor;
 }
 
@@ -109,10 +108,9 @@ void SliderConstraint_GetAnchorInB(btSliderConstraint* constraint, btVector3* an
 #pragma managed(pop)
 Vector3 SliderConstraint::AnchorInB::get()
 {
-	btVector3* anchorInBTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, anchorInBTemp);
 	SliderConstraint_GetAnchorInB(Native, anchorInBTemp);
 	Vector3 anchor = Math::BtVector3ToVector3(anchorInBTemp);
-	ALIGNED_FREE(anchorInBTemp);
 	return anchor;
 }
 
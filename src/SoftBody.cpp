@@ -582,11 +582,10 @@ void Body_GetAngularVelocity(btSoftBody::Body* body, btVector3* rPos, btVector3*
 Vector3 Body::GetAngularVelocity(Vector3 rPos)
 {
 	VECTOR3_CONV(rPos);
-	btVector3* velocityTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, velocityTemp);
 	Body_GetAngularVelocity(_native, VECTOR3_PTR(rPos), velocityTemp);
 	VECTOR3_DEL(rPos);
 	Vector3 velocity = Math::BtVector3ToVector3(velocityTemp);
-	ALIGNED_FREE(velocityTemp);
 	return velocity;
 }
 
@@ -599,11 +598,10 @@ void Body_GetVelocity(btSoftBody::Body* body, btVector3* rPos, btVector3* veloci
 Vector3 Body::Velocity(Vector3 rPos)
 {
 	VECTOR3_CONV(rPos);
-	btVector3* velocityTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, velocityTemp);
 	Body_GetVelocity(_native, VECTOR3_PTR(rPos), velocityTemp);
 	VECTOR3_DEL(rPos);
 	Vector3 velocity = Math::BtVector3ToVector3(velocityTemp);
-	ALIGNED_FREE(velocityTemp);
 	return velocity;
 }
 
@@ -615,10 +613,9 @@ void Body_GetAngularVelocity(btSoftBody::Body* body, btVector3* velocity)
 #pragma managed(pop)
 Vector3 Body::AngularVelocity::get()
 {
-	btVector3* velocityTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, velocityTemp);
 	Body_GetAngularVelocity(_native, velocityTemp);
 	Vector3 velocity = Math::BtVector3ToVector3(velocityTemp);
-	ALIGNED_FREE(velocityTemp);
 	return velocity;
 }
 
@@ -649,10 +646,9 @@ void Body_GetLinearVelocity(btSoftBody::Body* body, btVector3* velocity)
 #pragma managed(pop)
 Vector3 Body::LinearVelocity::get()
 {
-	btVector3* velocityTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, velocityTemp);
 	Body_GetLinearVelocity(_native, velocityTemp);
 	Vector3 velocity = Math::BtVector3ToVector3(velocityTemp);
-	ALIGNED_FREE(velocityTemp);
 	return velocity;
 }
 
@@ -2606,26 +2602,31 @@ void BulletSharp::SoftBody::SoftBody::AppendAngularJoint(AJoint::Specs^ specs, S
 void BulletSharp::SoftBody::SoftBody::AppendFace(int model, Material^ material)
 {
 	Native->appendFace(model, (btSoftBody::Material*)material->_native);
+	_topologyVersion++;
 }
 
 void BulletSharp::SoftBody::SoftBody::AppendFace(int model)
 {
 	Native->appendFace(model);
+	_topologyVersion++;
 }
 
 void BulletSharp::SoftBody::SoftBody::AppendFace()
 {
 	Native->appendFace();
+	_topologyVersion++;
 }
 
 void BulletSharp::SoftBody::SoftBody::AppendFace(int node0, int node1, int node2, Material^ material)
 {
 	Native->appendFace(node0, node1, node2, (btSoftBody::Material*)material->_native);
+	_topologyVersion++;
 }
 
 void BulletSharp::SoftBody::SoftBody::AppendFace(int node0, int node1, int node2)
 {
 	Native->appendFace(node0, node1, node2);
+	_topologyVersion++;
 }
 
 void BulletSharp::SoftBody::SoftBody::AppendLinearJoint(LJoint::Specs^ specs, SoftBody^ body)
@@ -2706,6 +2707,7 @@ void BulletSharp::SoftBody::SoftBody::AppendNode(Vector3 x, btScalar m)
 	VECTOR3_CONV(x);
 	Native->appendNode(VECTOR3_USE(x), m);
 	VECTOR3_DEL(x);
+	_topologyVersion++;
 }
 
 void BulletSharp::SoftBody::SoftBody::AppendNote(String^ text, Vector3 o, Face^ feature)
@@ -2813,16 +2815,19 @@ void BulletSharp::SoftBody::SoftBody::AppendNote(String^ text, Vector3 o)
 void BulletSharp::SoftBody::SoftBody::AppendTetra(int model, Material^ material)
 {
 	Native->appendTetra(model, (btSoftBody::Material*)material->_native);
+	_topologyVersion++;
 }
 
 void BulletSharp::SoftBody::SoftBody::AppendTetra(int node0, int node1, int node2, int node3, Material^ material)
 {
 	Native->appendTetra(node0, node1, node2, node3, (btSoftBody::Material*)material->_native);
+	_topologyVersion++;
 }
 
 void BulletSharp::SoftBody::SoftBody::AppendTetra(int node0, int node1, int node2, int node3)
 {
 	Native->appendTetra(node0, node1, node2, node3);
+	_topologyVersion++;
 }
 
 void BulletSharp::SoftBody::SoftBody::ApplyClusters(bool drift)
@@ -2878,10 +2883,9 @@ void SoftBody_ClusterCOM(btSoftBody* softBody, int cluster, btVector3* com)
 #pragma managed(pop)
 Vector3 BulletSharp::SoftBody::SoftBody::ClusterCom(int cluster)
 {
-	btVector3* tempClusterCom = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, tempClusterCom);
 	SoftBody_ClusterCOM(Native, cluster, tempClusterCom);
 	Vector3 com = Math::BtVector3ToVector3(tempClusterCom);
-	ALIGNED_FREE(tempClusterCom);
 	return com;
 }
 
@@ -2893,10 +2897,9 @@ void SoftBody_ClusterCOM(btSoftBody::Cluster* cluster, btVector3* com)
 #pragma managed(pop)
 Vector3 BulletSharp::SoftBody::SoftBody::ClusterCom(Cluster^ cluster)
 {
-	btVector3* tempClusterCom = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, tempClusterCom);
 	SoftBody_ClusterCOM(cluster->_native, tempClusterCom);
 	Vector3 com = Math::BtVector3ToVector3(tempClusterCom);
-	ALIGNED_FREE(tempClusterCom);
 	return com;
 }
 
@@ -2945,12 +2948,11 @@ void SoftBody_ClusterVelocity(btSoftBody::Cluster* cluster, btVector3* rPos, btV
 #pragma managed(pop)
 Vector3 BulletSharp::SoftBody::SoftBody::ClusterVelocity(Cluster^ cluster, Vector3 rPos)
 {
-	btVector3* tempVelocity = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, tempVelocity);
 	VECTOR3_CONV(rPos);
 	SoftBody_ClusterVelocity(cluster->_native, VECTOR3_PTR(rPos), tempVelocity);
 	VECTOR3_DEL(rPos);
 	Vector3 velocity = Math::BtVector3ToVector3(tempVelocity);
-	ALIGNED_FREE(tempVelocity);
 	return velocity;
 }
 
@@ -2965,13 +2967,23 @@ void BulletSharp::SoftBody::SoftBody::ClusterVImpulse(Cluster^ cluster, Vector3
 
 bool BulletSharp::SoftBody::SoftBody::CutLink(int node0, int node1, btScalar position)
 {
-	return Native->cutLink(node0, node1, position);
+	bool ret = Native->cutLink(node0, node1, position);
+	if (ret)
+	{
+		_topologyVersion++;
+	}
+	return ret;
 }
 
 bool BulletSharp::SoftBody::SoftBody::CutLink(Node^ node0, Node^ node1, btScalar position)
 {
-	return Native->cutLink((btSoftBody::Node*)node0->_native, (btSoftBody::Node*)node1->_native,
+	bool ret = Native->cutLink((btSoftBody::Node*)node0->_native, (btSoftBody::Node*)node1->_native,
 		position);
+	if (ret)
+	{
+		_topologyVersion++;
+	}
+	return ret;
 }
 
 void BulletSharp::SoftBody::SoftBody::DampClusters()
@@ -2998,10 +3010,9 @@ void SoftBody_EvaluateCom(btSoftBody* softBody, btVector3* result)
 
 Vector3 BulletSharp::SoftBody::SoftBody::EvaluateCom()
 {
-	btVector3* result = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, result);
 	SoftBody_EvaluateCom(Native, result);
 	Vector3 ret = Math::BtVector3ToVector3(result);
-	ALIGNED_FREE(result);
 	return ret;
 }
 
@@ -3027,16 +3038,14 @@ int BulletSharp::SoftBody::SoftBody::GenerateClusters(int k)
 
 void BulletSharp::SoftBody::SoftBody::GetAabb([Out] Vector3% aabbMin, [Out] Vector3% aabbMax)
 {
-	btVector3* aabbMinTemp = ALIGNED_NEW(btVector3);
-	btVector3* aabbMaxTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, aabbMinTemp);
+	ALIGNED_STACK(btVector3, aabbMaxTemp);
 
 	Native->getAabb(*aabbMinTemp, *aabbMaxTemp);
 
 	Math::BtVector3ToVector3(aabbMinTemp, aabbMin);
 	Math::BtVector3ToVector3(aabbMaxTemp, aabbMax);
 
-	ALIGNED_FREE(aabbMinTemp);
-	ALIGNED_FREE(aabbMaxTemp);
 }
 
 int BulletSharp::SoftBody::SoftBody::GetFaceVertexData([Out] array<Vector3>^% vertices)
@@ -3124,6 +3133,32 @@ int BulletSharp::SoftBody::SoftBody::GetFaceVertexNormalData([Out] array<Vector3
 	return vertexCount;
 }
 
+int BulletSharp::SoftBody::SoftBody::GetFaceIndices([Out] array<int>^% indices)
+{
+	btAlignedObjectArray<btSoftBody::Face>* faceArray = &Native->m_faces;
+	int faceCount = faceArray->size();
+	if (faceCount == 0) {
+		return 0;
+	}
+
+	int indexCount = faceCount * 3;
+
+	if (indices == nullptr || indices->Length != indexCount) {
+		indices = gcnew array<int>(indexCount);
+	}
+
+	int i, j;
+	const btSoftBody::Node* nodes = &Native->m_nodes[0];
+	pin_ptr<int> iPtr = &indices[0];
+	for (i = 0; i < faceCount; i++) {
+		for (j = 0; j < 3; j++) {
+			*iPtr++ = (int)(faceArray->at(i).m_n[j] - nodes);
+		}
+	}
+
+	return indexCount;
+}
+
 int BulletSharp::SoftBody::SoftBody::GetLinkVertexData([Out] array<Vector3>^% vertices)
 {
 	btAlignedObjectArray<btSoftBody::Link>* linkArray = &Native->m_links;
@@ -3192,6 +3227,79 @@ vsolver_t BulletSharp::SoftBody::SoftBody::GetSolver(btSoftBody::eVSolver::_ sol
 	return btSoftBody::getSolver(solver->_native);
 }
 */
+int BulletSharp::SoftBody::SoftBody::GetNodeVertexData([Out] array<Vector3>^% vertices)
+{
+	btAlignedObjectArray<btSoftBody::Node>* nodeArray = &Native->m_nodes;
+	int nodeCount = nodeArray->size();
+	if (nodeCount == 0) {
+		return 0;
+	}
+
+	if (vertices == nullptr || vertices->Length != nodeCount) {
+		vertices = gcnew array<Vector3>(nodeCount);
+	}
+
+	int i;
+	pin_ptr<Vector3> vPtr = &vertices[0];
+	for (i = 0; i < nodeCount; i++) {
+		Math::BtVector3ToVector3(&nodeArray->at(i).m_x, *vPtr++);
+	}
+
+	return nodeCount;
+}
+
+int BulletSharp::SoftBody::SoftBody::GetNodeVertexNormalData([Out] array<Vector3>^% data)
+{
+	btAlignedObjectArray<btSoftBody::Node>* nodeArray = &Native->m_nodes;
+	int nodeCount = nodeArray->size();
+	if (nodeCount == 0) {
+		return 0;
+	}
+
+	int vertexNormalCount = nodeCount * 2;
+
+	if (data == nullptr || data->Length != vertexNormalCount) {
+		data = gcnew array<Vector3>(vertexNormalCount);
+	}
+
+	int i;
+	pin_ptr<Vector3> vPtr = &data[0];
+	for (i = 0; i < nodeCount; i++) {
+		btSoftBody::Node* n = &nodeArray->at(i);
+		Math::BtVector3ToVector3(&n->m_x, *vPtr++);
+		Math::BtVector3ToVector3(&n->m_n, *vPtr++);
+	}
+
+	return nodeCount;
+}
+
+int BulletSharp::SoftBody::SoftBody::GetNodeVertexNormalData([Out] array<Vector3>^% vertices, [Out] array<Vector3>^% normals)
+{
+	btAlignedObjectArray<btSoftBody::Node>* nodeArray = &Native->m_nodes;
+	int nodeCount = nodeArray->size();
+	if (nodeCount == 0) {
+		return 0;
+	}
+
+	if (vertices == nullptr || vertices->Length != nodeCount) {
+		vertices = gcnew array<Vector3>(nodeCount);
+	}
+	if (normals == nullptr || normals->Length != nodeCount) {
+		normals = gcnew array<Vector3>(nodeCount);
+	}
+
+	int i;
+	pin_ptr<Vector3> vPtr = &vertices[0];
+	pin_ptr<Vector3> nPtr = &normals[0];
+	for (i = 0; i < nodeCount; i++) {
+		btSoftBody::Node* n = &nodeArray->at(i);
+		Math::BtVector3ToVector3(&n->m_x, *vPtr++);
+		Math::BtVector3ToVector3(&n->m_n, *nPtr++);
+	}
+
+	return nodeCount;
+}
+
 int BulletSharp::SoftBody::SoftBody::GetTetraVertexData([Out] array<Vector3>^% vertices)
 {
 	btAlignedObjectArray<btSoftBody::Tetra>* tetraArray = &Native->m_tetras;
@@ -3452,6 +3560,7 @@ void BulletSharp::SoftBody::SoftBody::PSolveSContacts(SoftBody^ psb, btScalar __
 void BulletSharp::SoftBody::SoftBody::RandomizeConstraints()
 {
 	Native->randomizeConstraints();
+	_topologyVersion++;
 }
 
 int BulletSharp::SoftBody::SoftBody::RayTest(Vector3 rayFrom, Vector3 rayTo, [Out] btScalar% mint, EFeature feature,
@@ -3485,6 +3594,7 @@ bool BulletSharp::SoftBody::SoftBody::RayTest(Vector3 rayFrom, Vector3 rayTo, SR
 void BulletSharp::SoftBody::SoftBody::Refine(ImplicitFn^ ifn, btScalar accurary, bool cut)
 {
 	Native->refine(ifn->_native, accurary, cut);
+	_topologyVersion++;
 }
 
 void BulletSharp::SoftBody::SoftBody::ReleaseCluster(int index)
@@ -3900,6 +4010,11 @@ void BulletSharp::SoftBody::SoftBody::TimeAccumulator::set(btScalar value)
 	Native->m_timeacc = value;
 }
 
+int BulletSharp::SoftBody::SoftBody::TopologyVersion::get()
+{
+	return _topologyVersion;
+}
+
 btScalar BulletSharp::SoftBody::SoftBody::TotalMass::get()
 {
 	return Native->getTotalMass();
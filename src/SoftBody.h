@@ -1739,6 +1739,7 @@ namespace BulletSharp
 			AlignedTetraArray^ _tetras;
 			AlignedIntArray^ _userIndexMapping;
 			Object^ _tag;
+			int _topologyVersion;
 
 		public:
 			!SoftBody();
@@ -1833,9 +1834,16 @@ namespace BulletSharp
 			int GetFaceVertexData([Out] array<Vector3>^% vertices); // helper
 			int GetFaceVertexNormalData([Out] array<Vector3>^% data); // helper
 			int GetFaceVertexNormalData([Out] array<Vector3>^% vertices, [Out] array<Vector3>^% normals); // helper
+			// Writes three node indices per face into indices, for use with GetNodeVertexData and GetNodeVertexNormalData.
+			// Only needs to be called again when TopologyVersion changes.
+			int GetFaceIndices([Out] array<int>^% indices); // helper
 			int GetLinkVertexData([Out] array<Vector3>^% vertices); // helper
 			int GetLinkVertexNormalData([Out] array<Vector3>^% data); // helper
 			btScalar GetMass(int node);
+			// Write one entry per node in Nodes order
+			int GetNodeVertexData([Out] array<Vector3>^% vertices); // helper
+			int GetNodeVertexNormalData([Out] array<Vector3>^% data); // helper
+			int GetNodeVertexNormalData([Out] array<Vector3>^% vertices, [Out] array<Vector3>^% normals); // helper
 			//static psolver_t GetSolver(btSoftBody::ePSolver::_ solver);
 			//static vsolver_t GetSolver(btSoftBody::eVSolver::_ solver);
 			int GetTetraVertexData([Out] array<Vector3>^% vertices); // helper
@@ -2033,6 +2041,13 @@ namespace BulletSharp
 				void set(btScalar value);
 			}
 
+			// Incremented whenever nodes or faces are added, cut, refined or reordered through this class.
+			// Changes made to the native body by other means are not tracked.
+			property int TopologyVersion
+			{
+				int get();
+			}
+
 			property btScalar TotalMass
 			{
 				btScalar get();
@@ -75,6 +75,20 @@ SoftBody::CpuVertexBufferDescriptor::CpuVertexBufferDescriptor(FloatArray^ array
 	_vertexBuffer = array;
 }
 
+SoftBody::CpuVertexBufferDescriptor::CpuVertexBufferDescriptor(IntPtr basePointer, int vertexOffset,
+	int vertexStride)
+	: VertexBufferDescriptor(new btCPUVertexBufferDescriptor((float*)basePointer.ToPointer(),
+		vertexOffset, vertexStride))
+{
+}
+
+SoftBody::CpuVertexBufferDescriptor::CpuVertexBufferDescriptor(IntPtr basePointer, int vertexOffset,
+	int vertexStride, int normalOffset, int normalStride)
+	: VertexBufferDescriptor(new btCPUVertexBufferDescriptor((float*)basePointer.ToPointer(),
+		vertexOffset, vertexStride, normalOffset, normalStride))
+{
+}
+
 IntPtr SoftBody::CpuVertexBufferDescriptor::BasePointer::get()
 {
 	return IntPtr(Native->getBasePointer());
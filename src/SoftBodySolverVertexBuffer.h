@@ -64,6 +64,11 @@ namespace BulletSharp
 			CpuVertexBufferDescriptor(FloatArray^ array, int vertexOffset, int vertexStride);
 			CpuVertexBufferDescriptor(FloatArray^ array, int vertexOffset, int vertexStride,
 				int normalOffset, int normalStride);
+			// Describes pinned or unmanaged memory, which must stay valid while the descriptor is used.
+			// Offsets and strides are counted in floats.
+			CpuVertexBufferDescriptor(IntPtr basePointer, int vertexOffset, int vertexStride);
+			CpuVertexBufferDescriptor(IntPtr basePointer, int vertexOffset, int vertexStride,
+				int normalOffset, int normalStride);
 
 			property IntPtr BasePointer
 			{
@@ -31,8 +31,8 @@ bool SphereBoxCollisionAlgorithm::GetSphereDistance(CollisionObjectWrapper^ boxO
 	Vector3% v3PointOnBox, Vector3% normal, btScalar% penetrationDepth, Vector3 v3SphereCenter,
 	btScalar fRadius, btScalar maxContactDistance)
 {
-	btVector3* v3PointOnBoxTemp = ALIGNED_NEW(btVector3);
-	btVector3* normalTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, v3PointOnBoxTemp);
+	ALIGNED_STACK(btVector3, normalTemp);
 	VECTOR3_CONV(v3SphereCenter);
 	btScalar penetrationDepthTemp;
 	bool ret = Native->getSphereDistance(boxObjWrap->_native, *v3PointOnBoxTemp,
@@ -41,8 +41,6 @@ bool SphereBoxCollisionAlgorithm::GetSphereDistance(CollisionObjectWrapper^ boxO
 	Math::BtVector3ToVector3(v3PointOnBoxTemp, v3PointOnBox);
 	Math::BtVector3ToVector3(normalTemp, normal);
 	penetrationDepth = penetrationDepthTemp;
-	ALIGNED_FREE(v3PointOnBoxTemp);
-	ALIGNED_FREE(normalTemp);
 	VECTOR3_DEL(v3SphereCenter);
 	return ret;
 }
@@ -52,16 +50,14 @@ btScalar SphereBoxCollisionAlgorithm::GetSpherePenetration(Vector3 boxHalfExtent
 {
 	VECTOR3_CONV(boxHalfExtent);
 	VECTOR3_CONV(sphereRelPos);
-	btVector3* closestPointTemp = ALIGNED_NEW(btVector3);
-	btVector3* normalTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, closestPointTemp);
+	ALIGNED_STACK(btVector3, normalTemp);
 	btScalar ret = Native->getSpherePenetration(VECTOR3_USE(boxHalfExtent), VECTOR3_USE(sphereRelPos),
 		*closestPointTemp, *normalTemp);
 	Math::BtVector3ToVector3(closestPointTemp, closestPoint);
 	Math::BtVector3ToVector3(normalTemp, normal);
 	VECTOR3_DEL(boxHalfExtent);
 	VECTOR3_DEL(sphereRelPos);
-	ALIGNED_FREE(closestPointTemp);
-	ALIGNED_FREE(normalTemp);
 	return ret;
 }
 
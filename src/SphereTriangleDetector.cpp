@@ -24,8 +24,8 @@ bool BulletSharp::SphereTriangleDetector::Collide(Vector3 sphereCenter, Vector3%
 	btScalar% depth, btScalar% timeOfImpact, btScalar contactBreakingThreshold)
 {
 	VECTOR3_CONV(sphereCenter);
-	btVector3* pointTemp = ALIGNED_NEW(btVector3);
-	btVector3* resultNormalTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, pointTemp);
+	ALIGNED_STACK(btVector3, resultNormalTemp);
 	btScalar depthTemp;
 	btScalar timeOfImpactTemp;
 	return Native->collide(VECTOR3_USE(sphereCenter), *pointTemp, *resultNormalTemp,
@@ -33,8 +33,6 @@ bool BulletSharp::SphereTriangleDetector::Collide(Vector3 sphereCenter, Vector3%
 	depth = depthTemp;
 	timeOfImpact = timeOfImpactTemp;
 	VECTOR3_DEL(sphereCenter);
-	ALIGNED_FREE(pointTemp);
-	ALIGNED_FREE(resultNormalTemp);
 }
 
 #endif
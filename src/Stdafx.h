@@ -254,6 +254,7 @@ using namespace System::Drawing;
 #ifdef DISABLE_GIMPACT
 #include <BulletCollision/GImpact/btGImpactShape.h>
 #endif
+#include <..\Extras\Serialize\BulletFileLoader\btBulletFile.h>
 #include <..\Extras\Serialize\BulletWorldImporter\btBulletWorldImporter.h>
 #include <..\Extras\Serialize\BulletXmlWorldImporter\btBulletXmlWorldImporter.h>
 #endif
@@ -337,4 +338,13 @@ inline GCHandle VoidPtrToGCHandle(void* pointer)
 #define ALIGNED_FREE(target) delete target
 #endif
 
+// Aligned stack storage for short-lived marshaling temporaries (btVector3, btTransform, etc.).
+// Native locals in managed functions are not guaranteed to be 16-byte aligned,
+// so the buffer is padded and the object is placed at the next aligned address.
+// Only use this for types with trivial destructors, the object is never destroyed.
+#define ALIGNED_STACK_STORAGE(name, targetClass) unsigned char name ## Storage[sizeof(targetClass) + 15]
+#define ALIGNED_STACK_PTR(name) ((void*)(((size_t)name ## Storage + 15) & ~(size_t)15))
+#define ALIGNED_STACK(targetClass, name) ALIGNED_STACK_STORAGE(name, targetClass); \
+	targetClass* name = new (ALIGNED_STACK_PTR(name)) targetClass
+
 using namespace BulletSharp;
@@ -0,0 +1,239 @@
+#include "StdAfx.h"
+
+#include "TableMotionState.h"
+
+#pragma managed(push, off)
+NativeTransformTable::NativeTransformTable(int capacity)
+{
+	_capacity = capacity;
+	_front = 0;
+	for (int i = 0; i < 2; i++)
+	{
+		_buffers[i] = (btTransform*)btAlignedAlloc(sizeof(btTransform) * capacity, 16);
+		for (int j = 0; j < capacity; j++)
+		{
+			_buffers[i][j].setIdentity();
+		}
+		_changedIndices[i].reserve(capacity);
+	}
+	_changedFlags = new unsigned char[capacity];
+	memset(_changedFlags, 0, capacity);
+}
+
+NativeTransformTable::~NativeTransformTable()
+{
+	btAlignedFree(_buffers[0]);
+	btAlignedFree(_buffers[1]);
+	delete[] _changedFlags;
+}
+
+void NativeTransformTable::setTransform(int index, const btTransform& transform)
+{
+	_buffers[0][index] = transform;
+	_buffers[1][index] = transform;
+}
+
+void NativeTransformTable::write(int index, const btTransform& transform)
+{
+	getBack()[index] = transform;
+	if (!_changedFlags[index])
+	{
+		_changedFlags[index] = 1;
+		_changedIndices[_front ^ 1].push_back(index);
+	}
+}
+
+int NativeTransformTable::swap()
+{
+	_front ^= 1;
+
+	// Bring the new back buffer up to date and reset the change tracking for the next step
+	btTransform* front = getFront();
+	btTransform* back = getBack();
+	const btAlignedObjectArray<int>& changed = _changedIndices[_front];
+	int count = changed.size();
+	for (int i = 0; i < count; i++)
+	{
+		int index = changed[i];
+		back[index] = front[index];
+		_changedFlags[index] = 0;
+	}
+	_changedIndices[_front ^ 1].resize(0);
+	return count;
+}
+
+NativeTableMotionState::NativeTableMotionState(NativeTransformTable* table, int index)
+{
+	_table = table;
+	_index = index;
+}
+
+void NativeTableMotionState::getWorldTransform(btTransform& worldTrans) const
+{
+	worldTrans = _table->getBack()[_index];
+}
+
+void NativeTableMotionState::setWorldTransform(const btTransform& worldTrans)
+{
+	_table->write(_index, worldTrans);
+}
+#pragma managed(pop)
+
+
+TransformTable::TransformTable(int capacity)
+{
+	if (capacity < 0)
+		throw gcnew ArgumentOutOfRangeException("capacity");
+	_native = new NativeTransformTable(capacity);
+}
+
+TransformTable::~TransformTable()
+{
+	this->!TransformTable();
+}
+
+TransformTable::!TransformTable()
+{
+	delete _native;
+	_native = NULL;
+}
+
+int TransformTable::CopyChangedIndices(array<int>^ indices)
+{
+	if (indices == nullptr)
+		throw gcnew ArgumentNullException("indices");
+
+	const btAlignedObjectArray<int>& changed = _native->getFrontChangedIndices();
+	int count = changed.size();
+	if (indices->Length < count)
+		throw gcnew ArgumentException("Array too small.", "indices");
+	if (count == 0)
+		return 0;
+
+	pin_ptr<int> indicesPtr = &indices[0];
+	memcpy(indicesPtr, &changed[0], count * sizeof(int));
+	return count;
+}
+
+int TransformTable::CopyChangedTransforms(array<int>^ indices, array<Matrix>^ transforms)
+{
+	if (transforms == nullptr)
+		throw gcnew ArgumentNullException("transforms");
+
+	int count = CopyChangedIndices(indices);
+	if (transforms->Length < count)
+		throw gcnew ArgumentException("Array too small.", "transforms");
+
+	const btAlignedObjectArray<int>& changed = _native->getFrontChangedIndices();
+	btTransform* front = _native->getFront();
+	for (int i = 0; i < count; i++)
+	{
+		Math::BtTransformToMatrix(&front[changed[i]], transforms[i]);
+	}
+	return count;
+}
+
+void TransformTable::CopyTransforms(array<Matrix>^ transforms)
+{
+	if (transforms == nullptr)
+		throw gcnew ArgumentNullException("transforms");
+
+	int capacity = _native->_capacity;
+	if (transforms->Length < capacity)
+		throw gcnew ArgumentException("Array too small.", "transforms");
+
+	btTransform* front = _native->getFront();
+	for (int i = 0; i < capacity; i++)
+	{
+		Math::BtTransformToMatrix(&front[i], transforms[i]);
+	}
+}
+
+Matrix TransformTable::GetTransform(int index)
+{
+	if ((unsigned int)index >= (unsigned int)_native->_capacity)
+		throw gcnew ArgumentOutOfRangeException("index");
+	return Math::BtTransformToMatrix(&_native->getFront()[index]);
+}
+
+void TransformTable::SetTransform(int index, Matrix transform)
+{
+	if ((unsigned int)index >= (unsigned int)_native->_capacity)
+		throw gcnew ArgumentOutOfRangeException("index");
+	TRANSFORM_CONV(transform);
+	_native->setTransform(index, TRANSFORM_USE(transform));
+	TRANSFORM_DEL(transform);
+}
+
+int TransformTable::Swap()
+{
+	return _native->swap();
+}
+
+int TransformTable::Capacity::get()
+{
+	return _native->_capacity;
+}
+
+int TransformTable::ChangedCount::get()
+{
+	return _native->getFrontChangedIndices().size();
+}
+
+IntPtr TransformTable::ChangedIndicesPointer::get()
+{
+	const btAlignedObjectArray<int>& changed = _native->getFrontChangedIndices();
+	return changed.size() ? IntPtr((void*)&changed[0]) : IntPtr::Zero;
+}
+
+IntPtr TransformTable::FrontBuffer::get()
+{
+	return IntPtr(_native->getFront());
+}
+
+
+#define Native static_cast<NativeTableMotionState*>(_native)
+
+TableMotionState::TableMotionState(TransformTable^ table, int index, Matrix startTransform)
+	: MotionState(0)
+{
+	if (table == nullptr)
+		throw gcnew ArgumentNullException("table");
+	if ((unsigned int)index >= (unsigned int)table->_native->_capacity)
+		throw gcnew ArgumentOutOfRangeException("index");
+
+	_table = table;
+	_native = new NativeTableMotionState(table->_native, index);
+	table->SetTransform(index, startTransform);
+}
+
+TableMotionState::TableMotionState(TransformTable^ table, int index)
+	: MotionState(0)
+{
+	if (table == nullptr)
+		throw gcnew ArgumentNullException("table");
+	if ((unsigned int)index >= (unsigned int)table->_native->_capacity)
+		throw gcnew ArgumentOutOfRangeException("index");
+
+	_table = table;
+	_native = new NativeTableMotionState(table->_native, index);
+}
+
+int TableMotionState::Index::get()
+{
+	return Native->_index;
+}
+
+TransformTable^ TableMotionState::Table::get()
+{
+	return _table;
+}
+
+Matrix TableMotionState::WorldTransform::get()
+{
+	return Math::BtTransformToMatrix(&Native->_table->getBack()[Native->_index]);
+}
+void TableMotionState::WorldTransform::set(Matrix value)
+{
+	_table->SetTransform(Native->_index, value);
+}
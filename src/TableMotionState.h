@@ -0,0 +1,119 @@
+#pragma once
+
+#include "MotionState.h"
+
+namespace BulletSharp
+{
+	// Native storage shared by TableMotionStates.
+	// Bullet writes into the back buffer while the front buffer holds the transforms
+	// published by the last call to Swap.
+	class NativeTransformTable
+	{
+	public:
+		btTransform* _buffers[2];
+		btAlignedObjectArray<int> _changedIndices[2];
+		unsigned char* _changedFlags;
+		int _front;
+		int _capacity;
+
+		NativeTransformTable(int capacity);
+		~NativeTransformTable();
+
+		btTransform* getFront() const { return _buffers[_front]; }
+		btTransform* getBack() const { return _buffers[_front ^ 1]; }
+		const btAlignedObjectArray<int>& getFrontChangedIndices() const { return _changedIndices[_front]; }
+
+		void setTransform(int index, const btTransform& transform);
+		void write(int index, const btTransform& transform);
+		int swap();
+	};
+
+	class NativeTableMotionState : public btMotionState
+	{
+	public:
+		NativeTransformTable* _table;
+		int _index;
+
+		NativeTableMotionState(NativeTransformTable* table, int index);
+
+		virtual void getWorldTransform(btTransform& worldTrans) const;
+		virtual void setWorldTransform(const btTransform& worldTrans);
+	};
+
+	public ref class TransformTable
+	{
+	internal:
+		NativeTransformTable* _native;
+
+	public:
+		!TransformTable();
+	protected:
+		~TransformTable();
+
+	public:
+		TransformTable(int capacity);
+
+		// Copies the transforms that changed before the last Swap.
+		// Element i of transforms receives the transform of object indices[i].
+		// Returns the number of changed transforms.
+		int CopyChangedTransforms(array<int>^ indices, array<Matrix>^ transforms);
+		// Copies the changed indices only, use GetTransform or FrontBuffer to read the transforms.
+		int CopyChangedIndices(array<int>^ indices);
+		void CopyTransforms(array<Matrix>^ transforms);
+		Matrix GetTransform(int index);
+		void SetTransform(int index, Matrix transform);
+		// Publishes the transforms written during the last simulation step.
+		// Call once after StepSimulation. Returns the number of changed transforms.
+		int Swap();
+
+		property int Capacity
+		{
+			int get();
+		}
+
+		property int ChangedCount
+		{
+			int get();
+		}
+
+		// Pointer to the published indices, valid until the next Swap.
+		property IntPtr ChangedIndicesPointer
+		{
+			IntPtr get();
+		}
+
+		// Pointer to the published btTransform array (Capacity elements), valid until the next Swap.
+		property IntPtr FrontBuffer
+		{
+			IntPtr get();
+		}
+	};
+
+	// A motion state that writes interpolated transforms into a TransformTable
+	// instead of calling back into managed code.
+	public ref class TableMotionState : MotionState
+	{
+	private:
+		TransformTable^ _table;
+
+	public:
+		TableMotionState(TransformTable^ table, int index, Matrix startTransform);
+		TableMotionState(TransformTable^ table, int index);
+
+		property int Index
+		{
+			int get();
+		}
+
+		property TransformTable^ Table
+		{
+			TransformTable^ get();
+		}
+
+		virtual property Matrix WorldTransform
+		{
+			Matrix get() override;
+			void set(Matrix value) override;
+		}
+	};
+};
@@ -7,14 +7,13 @@ void TransformUtil::CalculateDiffAxisAngle(Matrix transform0, Matrix transform1,
 {
 	TRANSFORM_CONV(transform0);
 	TRANSFORM_CONV(transform1);
-	btVector3* axisTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, axisTemp);
 	btScalar angleTemp;
 	btTransformUtil::calculateDiffAxisAngle(TRANSFORM_USE(transform0), TRANSFORM_USE(transform1),
 		*axisTemp, angleTemp);
 	TRANSFORM_DEL(transform0);
 	TRANSFORM_DEL(transform1);
 	Math::BtVector3ToVector3(axisTemp, axis);
-	ALIGNED_FREE(axisTemp);
 	angle = angleTemp;
 }
 
@@ -23,13 +22,12 @@ void TransformUtil::CalculateDiffAxisAngleQuaternion(Quaternion orn0, Quaternion
 {
 	QUATERNION_CONV(orn0);
 	QUATERNION_CONV(orn1a);
-	btVector3* axisTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, axisTemp);
 	btScalar angleTemp;
 	btTransformUtil::calculateDiffAxisAngleQuaternion(QUATERNION_USE(orn0), QUATERNION_USE(orn1a),
 		*axisTemp, angleTemp);
 	QUATERNION_DEL(orn0);
 	QUATERNION_DEL(orn1a);
-	ALIGNED_FREE(axisTemp);
 }
 
 void TransformUtil::CalculateVelocity(Matrix transform0, Matrix transform1, btScalar timeStep,
@@ -37,16 +35,14 @@ void TransformUtil::CalculateVelocity(Matrix transform0, Matrix transform1, btSc
 {
 	TRANSFORM_CONV(transform0);
 	TRANSFORM_CONV(transform1);
-	btVector3* linVelTemp = ALIGNED_NEW(btVector3);
-	btVector3* angVelTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, linVelTemp);
+	ALIGNED_STACK(btVector3, angVelTemp);
 	btTransformUtil::calculateVelocity(TRANSFORM_USE(transform0), TRANSFORM_USE(transform1),
 		timeStep, *linVelTemp, *angVelTemp);
 	TRANSFORM_DEL(transform0);
 	TRANSFORM_DEL(transform1);
 	Math::BtVector3ToVector3(linVelTemp, linVel);
 	Math::BtVector3ToVector3(angVelTemp, angVel);
-	ALIGNED_FREE(linVelTemp);
-	ALIGNED_FREE(angVelTemp);
 }
 
 void TransformUtil::CalculateVelocityQuaternion(Vector3 pos0, Vector3 pos1, Quaternion orn0,
@@ -56,8 +52,8 @@ void TransformUtil::CalculateVelocityQuaternion(Vector3 pos0, Vector3 pos1, Quat
 	VECTOR3_CONV(pos1);
 	QUATERNION_CONV(orn0);
 	QUATERNION_CONV(orn1);
-	btVector3* linVelTemp = ALIGNED_NEW(btVector3);
-	btVector3* angVelTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, linVelTemp);
+	ALIGNED_STACK(btVector3, angVelTemp);
 	btTransformUtil::calculateVelocityQuaternion(VECTOR3_USE(pos0), VECTOR3_USE(pos1),
 		QUATERNION_USE(orn0), QUATERNION_USE(orn1), timeStep, *linVelTemp,
 		*angVelTemp);
@@ -67,8 +63,6 @@ void TransformUtil::CalculateVelocityQuaternion(Vector3 pos0, Vector3 pos1, Quat
 	QUATERNION_DEL(orn1);
 	Math::BtVector3ToVector3(linVelTemp, linVel);
 	Math::BtVector3ToVector3(angVelTemp, angVel);
-	ALIGNED_FREE(linVelTemp);
-	ALIGNED_FREE(angVelTemp);
 }
 
 void TransformUtil::IntegrateTransform(Matrix curTrans, Vector3 linvel, Vector3 angvel,
@@ -77,14 +71,13 @@ void TransformUtil::IntegrateTransform(Matrix curTrans, Vector3 linvel, Vector3
 	TRANSFORM_CONV(curTrans);
 	VECTOR3_CONV(linvel);
 	VECTOR3_CONV(angvel);
-	btTransform* predictedTransformTemp = ALIGNED_NEW(btTransform);
+	ALIGNED_STACK(btTransform, predictedTransformTemp);
 	btTransformUtil::integrateTransform(TRANSFORM_USE(curTrans), VECTOR3_USE(linvel),
 		VECTOR3_USE(angvel), timeStep, *predictedTransformTemp);
 	TRANSFORM_DEL(curTrans);
 	VECTOR3_DEL(linvel);
 	VECTOR3_DEL(angvel);
 	Math::BtTransformToMatrix(predictedTransformTemp, predictedTransform);
-	ALIGNED_FREE(predictedTransformTemp);
 }
 
 
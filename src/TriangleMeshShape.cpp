@@ -25,21 +25,19 @@ void TriangleMeshShape_LocalGetSupportingVertexWithoutMargin(btTriangleMeshShape
 Vector3 TriangleMeshShape::LocalGetSupportingVertex(Vector3 vec)
 {
 	VECTOR3_CONV(vec);
-	btVector3* vecOut = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, vecOut);
 	TriangleMeshShape_LocalGetSupportingVertex(Native, VECTOR3_PTR(vec), vecOut);
 	Vector3 vertex = Math::BtVector3ToVector3(vecOut);
 	VECTOR3_DEL(vec);
-	ALIGNED_FREE(vecOut);
 	return vertex;
 }
 
 Vector3 TriangleMeshShape::LocalGetSupportingVertexWithoutMargin(Vector3 vec)
 {
 	VECTOR3_CONV(vec);
-	btVector3* vecOut = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, vecOut);
 	TriangleMeshShape_LocalGetSupportingVertexWithoutMargin(Native, VECTOR3_PTR(vec), vecOut);
 	Vector3 vertex = Math::BtVector3ToVector3(vecOut);	VECTOR3_DEL(vec);
-	ALIGNED_FREE(vecOut);
 	return vertex;
 }
 
@@ -31,21 +31,18 @@ TriangleShape::TriangleShape(Vector3 point0, Vector3 point1, Vector3 point2)
 
 void TriangleShape::CalcNormal([Out] Vector3% normal)
 {
-	btVector3* normalTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, normalTemp);
 	Native->calcNormal(*normalTemp);
 	Math::BtVector3ToVector3(normalTemp, normal);
-	ALIGNED_FREE(normalTemp);
 }
 
 void TriangleShape::GetPlaneEquation(int index, [Out] Vector3% planeNormal, [Out] Vector3% planeSupport)
 {
-	btVector3* planeNormalTemp = ALIGNED_NEW(btVector3);
-	btVector3* planeSupportTemp = ALIGNED_NEW(btVector3);
+	ALIGNED_STACK(btVector3, planeNormalTemp);
+	ALIGNED_STACK(btVector3, planeSupportTemp);
 	Native->getPlaneEquation(index, *planeNormalTemp, *planeSupportTemp);
 	Math::BtVector3ToVector3(planeNormalTemp, planeNormal);
 	Math::BtVector3ToVector3(planeSupportTemp, planeSupport);
-	ALIGNED_FREE(planeNormalTemp);
-	ALIGNED_FREE(planeSupportTemp);
 }
 /*
 IntPtr TriangleShape::GetVertexPtr(int index)
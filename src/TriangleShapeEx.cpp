@@ -39,10 +39,10 @@ void GimTriangleContact::CopyFrom(GimTriangleContact^ other)
 void GimTriangleContact::MergePoints(Vector4 plane, btScalar margin, array<Vector3>^ points)
 {
 	btVector3* pointsTemp = Math::Vector3ArrayToUnmanaged(points);
-	btVector4* planeTemp = Math::Vector4ToBtVector4(plane);
-	_native->merge_points(*planeTemp, margin, pointsTemp, points->Length);
+	VECTOR4_CONV(plane);
+	_native->merge_points(VECTOR4_USE(plane), margin, pointsTemp, points->Length);
 	delete[] pointsTemp;
-	delete planeTemp;
+	VECTOR4_DEL(plane);
 }
 
 btScalar GimTriangleContact::PenetrationDepth::get()
@@ -127,10 +127,9 @@ bool PrimitiveTriangle::FindTriangleCollisionClipMethod(PrimitiveTriangle^ other
 
 void PrimitiveTriangle::GetEdgePlane(int edge_index, [Out] Vector4% plane)
 {
-	btVector4* planeTemp = ALIGNED_NEW(btVector4);
+	ALIGNED_STACK(btVector4, planeTemp);
 	_native->get_edge_plane(edge_index, *planeTemp);
 	plane = Math::BtVector4ToVector4(planeTemp);
-	ALIGNED_FREE(planeTemp);
 }
 
 bool PrimitiveTriangle::OverlapTestConservative(PrimitiveTriangle^ other)
@@ -213,9 +212,9 @@ void TriangleShapeEx::ApplyTransform(Matrix transform)
 
 void TriangleShapeEx::BuildTriPlane(Vector4 plane)
 {
-	btVector4* planeTemp = Math::Vector4ToBtVector4(plane);
-	Native->buildTriPlane(*planeTemp);
-	delete planeTemp;
+	VECTOR4_CONV(plane);
+	Native->buildTriPlane(VECTOR4_USE(plane));
+	VECTOR4_DEL(plane);
 }
 
 bool TriangleShapeEx::OverlapTestConservative(TriangleShapeEx^ other)
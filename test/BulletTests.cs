@@ -1,4 +1,5 @@
 ﻿using System;
+using System.Collections.Generic;
 using BulletSharp;
 
 namespace BulletSharpTest
@@ -11,6 +12,12 @@ namespace BulletSharpTest
         {
             TestAxisSweepOverlapCallback();
             TestGCCollection();
+            TestWorldHandles();
+            TestSwapAndRemove();
+            TestAddRemoveRange();
+            TestCopyRanges();
+            TestBufferedDebugDraw();
+            TestCollectionEnumerators();
         }
 
         RigidBody CreateBody(float mass, CollisionShape shape, Vector3 offset)
@@ -275,6 +282,332 @@ namespace BulletSharpTest
 
         }
 
+        DefaultCollisionConfiguration collectionConf;
+        CollisionDispatcher collectionDispatcher;
+        DbvtBroadphase collectionBroadphase;
+
+        DiscreteDynamicsWorld CreateCollectionTestWorld()
+        {
+            collectionConf = new DefaultCollisionConfiguration();
+            collectionDispatcher = new CollisionDispatcher(collectionConf);
+            collectionBroadphase = new DbvtBroadphase();
+            return new DiscreteDynamicsWorld(collectionDispatcher, collectionBroadphase, null, collectionConf);
+        }
+
+        void DisposeCollectionTestWorld(DiscreteDynamicsWorld testWorld, IEnumerable<RigidBody> bodies)
+        {
+            foreach (var body in bodies)
+            {
+                testWorld.CollisionObjectArray.Remove(body);
+                body.MotionState.Dispose();
+                body.Dispose();
+            }
+            testWorld.Dispose();
+            collectionBroadphase.Dispose();
+            collectionDispatcher.Dispose();
+            collectionConf.Dispose();
+            collectionBroadphase = null;
+            collectionDispatcher = null;
+            collectionConf = null;
+        }
+
+        // Creates a body without adding it to a world
+        static RigidBody CreateFreeBody(CollisionShape shape, Vector3 offset)
+        {
+            using (var constInfo = new RigidBodyConstructionInfo(1, new DefaultMotionState(), shape, shape.CalculateLocalInertia(1)))
+            {
+                var body = new RigidBody(constInfo);
+                body.Translate(offset);
+                return body;
+            }
+        }
+
+        static void ExpectException<T>(Action action, string failMessage) where T : Exception
+        {
+            try
+            {
+                action();
+            }
+            catch (T)
+            {
+                return;
+            }
+            Console.WriteLine(failMessage);
+        }
+
+        void TestWorldHandles()
+        {
+            var testWorld = CreateCollectionTestWorld();
+            var shape = new SphereShape(1);
+            var body0 = CreateFreeBody(shape, new Vector3(0, 0, 0));
+            var body1 = CreateFreeBody(shape, new Vector3(5, 0, 0));
+            AlignedCollisionObjectArray objects = testWorld.CollisionObjectArray;
+
+            objects.Add(body0);
+            int handle0 = body0.WorldHandle;
+            if (handle0 == 0 || objects.GetByHandle(handle0) != body0)
+            {
+                Console.WriteLine("WorldHandle lookup FAILED!");
+            }
+
+            // The freed slot is reused, but the handle of the removed body must not find the new one
+            objects.Remove(body0);
+            objects.Add(body1);
+            if (body0.WorldHandle != 0 || body1.WorldHandle == 0 || body1.WorldHandle == handle0)
+            {
+                Console.WriteLine("WorldHandle reuse FAILED!");
+            }
+            if (objects.GetByHandle(body1.WorldHandle) != body1)
+            {
+                Console.WriteLine("WorldHandle lookup after reuse FAILED!");
+            }
+            ExpectException<ArgumentOutOfRangeException>(() => objects.GetByHandle(handle0),
+                "Stale WorldHandle lookup FAILED!");
+
+            // Brings the slot back to the generation of handle0 modulo 256
+            for (int i = 0; i < 255; i++)
+            {
+                objects.Remove(body1);
+                objects.Add(body1);
+            }
+            if (body1.WorldHandle == handle0)
+            {
+                Console.WriteLine("WorldHandle generation FAILED!");
+            }
+            ExpectException<ArgumentOutOfRangeException>(() => objects.GetByHandle(handle0),
+                "Stale WorldHandle lookup after many reuses FAILED!");
+
+            DisposeCollectionTestWorld(testWorld, new[] { body0, body1 });
+            shape.Dispose();
+        }
+
+        void TestSwapAndRemove()
+        {
+            var testWorld = CreateCollectionTestWorld();
+            var shape = new SphereShape(1);
+            var bodies = new[]
+            {
+                CreateFreeBody(shape, new Vector3(0, 0, 0)),
+                CreateFreeBody(shape, new Vector3(5, 0, 0)),
+                CreateFreeBody(shape, new Vector3(10, 0, 0))
+            };
+            AlignedCollisionObjectArray objects = testWorld.CollisionObjectArray;
+            foreach (var body in bodies)
+            {
+                objects.Add(body);
+            }
+
+            objects.Swap(0, 2);
+            if (objects[0] != bodies[2] || objects[2] != bodies[0] ||
+                objects.IndexOf(bodies[0]) != 2 || objects.IndexOf(bodies[2]) != 0)
+            {
+                Console.WriteLine("Swap FAILED!");
+            }
+            if (objects.GetByHandle(bodies[0].WorldHandle) != bodies[0])
+            {
+                Console.WriteLine("WorldHandle lookup after Swap FAILED!");
+            }
+
+            if (!objects.Remove(bodies[0]) || objects.Count != 2 ||
+                objects.IndexOf(bodies[2]) != 0 || objects.IndexOf(bodies[1]) != 1 || objects.Contains(bodies[0]))
+            {
+                Console.WriteLine("Remove after Swap FAILED!");
+            }
+            testWorld.StepSimulation(1.0f / 60.0f);
+
+            ExpectException<InvalidOperationException>(() => objects[0] = bodies[0],
+                "Replacing a world object FAILED!");
+
+            DisposeCollectionTestWorld(testWorld, bodies);
+            shape.Dispose();
+        }
+
+        void TestAddRemoveRange()
+        {
+            var testWorld = CreateCollectionTestWorld();
+            var shape = new SphereShape(1);
+            var bodies = new RigidBody[10];
+            for (int i = 0; i < bodies.Length; i++)
+            {
+                bodies[i] = CreateFreeBody(shape, new Vector3(i * 3, 0, 0));
+            }
+            AlignedCollisionObjectArray objects = testWorld.CollisionObjectArray;
+
+            objects.AddRange(bodies);
+            if (objects.Count != bodies.Length)
+            {
+                Console.WriteLine("AddRange count FAILED!");
+            }
+            for (int i = 0; i < bodies.Length; i++)
+            {
+                if (objects.IndexOf(bodies[i]) != i || bodies[i].BroadphaseHandle == null ||
+                    objects.GetByHandle(bodies[i].WorldHandle) != bodies[i])
+                {
+                    Console.WriteLine("AddRange FAILED!");
+                    break;
+                }
+            }
+            testWorld.StepSimulation(1.0f / 60.0f);
+
+            var removedBodies = new RigidBody[5];
+            Array.Copy(bodies, removedBodies, removedBodies.Length);
+            if (objects.RemoveRange(removedBodies) != removedBodies.Length || objects.Count != bodies.Length - removedBodies.Length)
+            {
+                Console.WriteLine("RemoveRange count FAILED!");
+            }
+            foreach (var body in removedBodies)
+            {
+                if (objects.Contains(body) || body.WorldHandle != 0 || body.BroadphaseHandle != null)
+                {
+                    Console.WriteLine("RemoveRange FAILED!");
+                    break;
+                }
+            }
+            if (objects.RemoveRange(removedBodies) != 0)
+            {
+                Console.WriteLine("RemoveRange of removed bodies FAILED!");
+            }
+            testWorld.StepSimulation(1.0f / 60.0f);
+
+            ExpectException<ArgumentException>(() => objects.AddRange(removedBodies, new short[5], null),
+                "AddRange with one filter array FAILED!");
+            ExpectException<ArgumentException>(() => objects.AddRange(removedBodies, new short[4], new short[4]),
+                "AddRange with short filter arrays FAILED!");
+
+            DisposeCollectionTestWorld(testWorld, bodies);
+            shape.Dispose();
+        }
+
+        void TestCopyRanges()
+        {
+            var scalars = new AlignedScalarArray();
+            scalars.CopyFrom(new float[] { 1, 2, 3, 4 });
+            var scalarOutput = new float[] { 9, 9, 9 };
+            scalars.CopyTo(1, scalarOutput, 0, 3);
+            if (scalars.Count != 4 || scalarOutput[0] != 2 || scalarOutput[1] != 3 || scalarOutput[2] != 4)
+            {
+                Console.WriteLine("AlignedScalarArray.CopyTo FAILED!");
+            }
+
+            scalarOutput = new float[] { 9, 9, 9 };
+            ExpectException<ArgumentOutOfRangeException>(() => scalars.CopyTo(2, scalarOutput, 0, 3),
+                "AlignedScalarArray.CopyTo source range check FAILED!");
+            ExpectException<ArgumentOutOfRangeException>(() => scalars.CopyTo(0, scalarOutput, 1, 3),
+                "AlignedScalarArray.CopyTo destination range check FAILED!");
+            ExpectException<ArgumentOutOfRangeException>(() => scalars.CopyTo(0, scalarOutput, 0, -1),
+                "AlignedScalarArray.CopyTo count check FAILED!");
+            if (scalarOutput[0] != 9 || scalarOutput[1] != 9 || scalarOutput[2] != 9)
+            {
+                Console.WriteLine("AlignedScalarArray.CopyTo wrote out of range!");
+            }
+            ExpectException<ArgumentOutOfRangeException>(() => scalars.CopyFrom(2, new float[3], 0, 3),
+                "AlignedScalarArray.CopyFrom range check FAILED!");
+            if (scalars[2] != 3 || scalars[3] != 4)
+            {
+                Console.WriteLine("AlignedScalarArray.CopyFrom wrote out of range!");
+            }
+            scalars.Dispose();
+
+            var vectors = new AlignedVector3Array();
+            vectors.CopyFrom(new[] { new Vector3(1, 2, 3), new Vector3(4, 5, 6) });
+            var vectorOutput = new Vector3[2];
+            vectors.CopyTo(0, vectorOutput, 0, 2);
+            if (vectors.Count != 2 || vectorOutput[0] != new Vector3(1, 2, 3) || vectorOutput[1] != new Vector3(4, 5, 6))
+            {
+                Console.WriteLine("AlignedVector3Array.CopyTo FAILED!");
+            }
+            ExpectException<ArgumentOutOfRangeException>(() => vectors.CopyTo(1, vectorOutput, 0, 2),
+                "AlignedVector3Array.CopyTo range check FAILED!");
+            ExpectException<ArgumentOutOfRangeException>(() => vectors.CopyFrom(0, vectorOutput, 1, 2),
+                "AlignedVector3Array.CopyFrom range check FAILED!");
+            vectors.Dispose();
+        }
+
+        void TestBufferedDebugDraw()
+        {
+            var testWorld = CreateCollectionTestWorld();
+            var shape = new BoxShape(1);
+            var body = CreateFreeBody(shape, new Vector3(2, 0, 0));
+            testWorld.AddRigidBody(body);
+
+            var drawer = new BufferedDebugDraw();
+            drawer.DebugMode = DebugDrawModes.DrawWireframe;
+            testWorld.DebugDrawer = drawer;
+            testWorld.DebugDrawWorld();
+
+            // The 12 edges of the box, every vertex is a corner at (2 +- 1, +-1, +-1)
+            DebugDrawVertex[] vertices = null;
+            int count = drawer.CopyLineVertices(ref vertices);
+            if (count != 24 || drawer.LineVertexCount != 24 || drawer.TriangleVertexCount != 0)
+            {
+                Console.WriteLine("BufferedDebugDraw vertex count FAILED!");
+            }
+            for (int i = 0; i < count; i++)
+            {
+                DebugDrawVertex v = vertices[i];
+                if (Math.Abs(Math.Abs(v.X - 2) - 1) > 0.001f || Math.Abs(Math.Abs(v.Y) - 1) > 0.001f ||
+                    Math.Abs(Math.Abs(v.Z) - 1) > 0.001f || ((v.Color >> 24) & 0xFF) != 0xFF)
+                {
+                    Console.WriteLine("BufferedDebugDraw vertex FAILED!");
+                    break;
+                }
+            }
+
+            // Only x <= 0 is inside, so the whole box is culled
+            drawer.Clear();
+            drawer.SetFrustum(new[] { new Vector4(-1, 0, 0, 0) });
+            testWorld.DebugDrawWorld();
+            if (drawer.LineVertexCount != 0 || drawer.LineVertices != IntPtr.Zero)
+            {
+                Console.WriteLine("BufferedDebugDraw culling FAILED!");
+            }
+
+            testWorld.DebugDrawer = null;
+            DisposeCollectionTestWorld(testWorld, new[] { body });
+            drawer.Dispose();
+            shape.Dispose();
+        }
+
+        void TestCollectionEnumerators()
+        {
+            var testWorld = CreateCollectionTestWorld();
+            var shape = new SphereShape(1);
+            var bodies = new[]
+            {
+                CreateFreeBody(shape, new Vector3(0, 0, 0)),
+                CreateFreeBody(shape, new Vector3(5, 0, 0)),
+                CreateFreeBody(shape, new Vector3(10, 0, 0))
+            };
+            AlignedCollisionObjectArray objects = testWorld.CollisionObjectArray;
+            objects.AddRange(bodies);
+
+            int index = 0;
+            foreach (CollisionObject obj in objects)
+            {
+                if (obj != bodies[index])
+                {
+                    Console.WriteLine("CollisionObjectArray enumeration FAILED!");
+                    break;
+                }
+                index++;
+            }
+            if (index != bodies.Length)
+            {
+                Console.WriteLine("CollisionObjectArray enumeration count FAILED!");
+            }
+
+            ExpectException<InvalidOperationException>(() =>
+            {
+                foreach (CollisionObject obj in objects)
+                {
+                    objects.Remove(obj);
+                }
+            }, "Remove during enumeration FAILED!");
+
+            DisposeCollectionTestWorld(testWorld, bodies);
+            shape.Dispose();
+        }
+
         void onDisposed(object sender, EventArgs e)
         {
             //Console.WriteLine("OnDisposed: " + sender.ToString());
@@ -1,4 +1,5 @@
 ﻿using System;
+using System.Collections.Generic;
 using BulletSharp;
 using BulletSharp.SoftBody;
 
@@ -43,6 +44,524 @@ namespace BulletSharpTest
             ForceGC();
             TestWeakRefs();
             ClearRefs();
+
+            TestSolverThreads();
+            TestBatchedLinkSolver();
+            TestParallelLinkSolver();
+            TestSleeping();
+            TestWakeByContact();
+            TestWakeByAnchor();
+            TestReducedLod();
+            TestRayTestBatchThreads();
+            TestCulledDebugDraw();
+        }
+
+        // Drops a box onto two of several hanging patches and returns the node positions of all patches
+        Vector3[] SimulatePatches(int numThreads, bool batchedLinks, int parallelLinkThreshold = 0, int resolution = 12)
+        {
+            var collisionConf = new SoftBodyRigidBodyCollisionConfiguration();
+            var dispatcher = new CollisionDispatcher(collisionConf);
+            var broadphase = new DbvtBroadphase();
+            var softBodySolver = new DefaultSoftBodySolver();
+            softBodySolver.NumThreads = numThreads;
+            softBodySolver.UseBatchedLinkSolver = batchedLinks;
+            softBodySolver.ParallelLinkThreshold = parallelLinkThreshold;
+            var world = new SoftRigidDynamicsWorld(dispatcher, broadphase, null, collisionConf, softBodySolver);
+            world.Gravity = new Vector3(0, -10, 0);
+
+            var softBodyWorldInfo = new SoftBodyWorldInfo();
+            softBodyWorldInfo.Gravity = world.Gravity;
+            softBodyWorldInfo.Dispatcher = dispatcher;
+            softBodyWorldInfo.Broadphase = broadphase;
+            softBodyWorldInfo.SparseSdf.Initialize();
+
+            const int numPatches = 8;
+            var patches = new SoftBody[numPatches];
+            for (int i = 0; i < numPatches; i++)
+            {
+                float x = i * 12;
+                var patch = SoftBodyHelpers.CreatePatch(softBodyWorldInfo,
+                    new Vector3(x - 5, 10, -5), new Vector3(x + 5, 10, -5),
+                    new Vector3(x - 5, 10, 5), new Vector3(x + 5, 10, 5), resolution, resolution, 1 + 2, true);
+                patch.Cfg.PIterations = 4;
+                patch.TotalMass = 1;
+                world.AddSoftBody(patch);
+                patches[i] = patch;
+            }
+
+            var boxShape = new BoxShape(10, 1, 2);
+            var constInfo = new RigidBodyConstructionInfo(1, new DefaultMotionState(), boxShape,
+                boxShape.CalculateLocalInertia(1));
+            var box = new RigidBody(constInfo);
+            box.Translate(new Vector3(6, 13, 0));
+            world.AddRigidBody(box);
+
+            for (int i = 0; i < 120; i++)
+            {
+                world.StepSimulation(1.0f / 60.0f);
+            }
+
+            var positions = new List<Vector3>();
+            foreach (var patch in patches)
+            {
+                for (int i = 0; i < patch.Nodes.Count; i++)
+                {
+                    positions.Add(patch.Nodes[i].X);
+                }
+                world.RemoveSoftBody(patch);
+                patch.Dispose();
+            }
+            world.RemoveRigidBody(box);
+            box.Dispose();
+            constInfo.MotionState.Dispose();
+            constInfo.Dispose();
+            boxShape.Dispose();
+
+            world.Dispose();
+            softBodyWorldInfo.Dispose();
+            softBodySolver.Dispose();
+            broadphase.Dispose();
+            dispatcher.Dispose();
+            collisionConf.Dispose();
+            return positions.ToArray();
+        }
+
+        static bool PositionsMatch(Vector3[] expected, Vector3[] actual, float tolerance)
+        {
+            if (expected.Length != actual.Length)
+            {
+                return false;
+            }
+            for (int i = 0; i < expected.Length; i++)
+            {
+                if ((expected[i] - actual[i]).Length > tolerance)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void TestSolverThreads()
+        {
+            // Bodies are grouped so that each group runs the same operations as the serial solver
+            var serial = SimulatePatches(1, false);
+            var threaded = SimulatePatches(4, false);
+            if (!PositionsMatch(serial, threaded, 0))
+            {
+                Console.WriteLine("DefaultSoftBodySolver: NumThreads = 4 doesn't match NumThreads = 1!");
+            }
+        }
+
+        void TestBatchedLinkSolver()
+        {
+            // Links in a batch share no nodes, only the SSE rounding may differ from the scalar solver
+            var scalar = SimulatePatches(1, false);
+            var batched = SimulatePatches(1, true);
+            if (!PositionsMatch(scalar, batched, 1e-3f))
+            {
+                Console.WriteLine("DefaultSoftBodySolver: UseBatchedLinkSolver changes the result!");
+            }
+
+            var batchedThreaded = SimulatePatches(4, true);
+            if (!PositionsMatch(batched, batchedThreaded, 0))
+            {
+                Console.WriteLine("DefaultSoftBodySolver: batched links with NumThreads = 4 don't match NumThreads = 1!");
+            }
+        }
+
+        void TestParallelLinkSolver()
+        {
+            // Links of one color share no nodes, so splitting them between threads doesn't change the result.
+            // The patches are large enough for each color to be split.
+            var colored = SimulatePatches(1, false, 100, 40);
+            var coloredThreaded = SimulatePatches(4, false, 100, 40);
+            if (!PositionsMatch(colored, coloredThreaded, 0))
+            {
+                Console.WriteLine("DefaultSoftBodySolver: colored links with NumThreads = 4 don't match NumThreads = 1!");
+            }
+
+            var coloredBatched = SimulatePatches(4, true, 100, 40);
+            if (!PositionsMatch(colored, coloredBatched, 1e-3f))
+            {
+                Console.WriteLine("DefaultSoftBodySolver: batched colored links change the result!");
+            }
+        }
+
+        SoftBodyRigidBodyCollisionConfiguration tierConf;
+        CollisionDispatcher tierDispatcher;
+        DbvtBroadphase tierBroadphase;
+        SoftBodyWorldInfo tierWorldInfo;
+
+        SoftRigidDynamicsWorld CreateTierTestWorld(DefaultSoftBodySolver softBodySolver)
+        {
+            tierConf = new SoftBodyRigidBodyCollisionConfiguration();
+            tierDispatcher = new CollisionDispatcher(tierConf);
+            tierBroadphase = new DbvtBroadphase();
+            var world = new SoftRigidDynamicsWorld(tierDispatcher, tierBroadphase, null, tierConf, softBodySolver);
+            world.Gravity = new Vector3(0, -10, 0);
+
+            tierWorldInfo = new SoftBodyWorldInfo();
+            tierWorldInfo.Gravity = world.Gravity;
+            tierWorldInfo.Dispatcher = tierDispatcher;
+            tierWorldInfo.Broadphase = tierBroadphase;
+            tierWorldInfo.SparseSdf.Initialize();
+            return world;
+        }
+
+        // Patch with pinned corners that settles quickly
+        SoftBody CreateTierTestPatch(SoftRigidDynamicsWorld world, float height)
+        {
+            var patch = SoftBodyHelpers.CreatePatch(tierWorldInfo,
+                new Vector3(-5, height, -5), new Vector3(5, height, -5),
+                new Vector3(-5, height, 5), new Vector3(5, height, 5), 9, 9, 1 + 2 + 4 + 8, true);
+            patch.Cfg.DP = 0.1f;
+            patch.TotalMass = 0.5f;
+            world.AddSoftBody(patch);
+            return patch;
+        }
+
+        RigidBody CreateTierTestBox(SoftRigidDynamicsWorld world, float mass, Vector3 halfExtents, Vector3 position)
+        {
+            var shape = new BoxShape(halfExtents);
+            var inertia = mass != 0 ? shape.CalculateLocalInertia(mass) : Vector3.Zero;
+            var constInfo = new RigidBodyConstructionInfo(mass, new DefaultMotionState(), shape, inertia);
+            var body = new RigidBody(constInfo);
+            constInfo.Dispose();
+            body.Translate(position);
+            world.AddRigidBody(body);
+            return body;
+        }
+
+        void DisposeTierTestWorld(SoftRigidDynamicsWorld world, DefaultSoftBodySolver softBodySolver)
+        {
+            while (world.CollisionObjectArray.Count != 0)
+            {
+                var obj = world.CollisionObjectArray[0];
+                world.CollisionObjectArray.Remove(obj);
+                var body = obj as RigidBody;
+                if (body != null)
+                {
+                    body.MotionState.Dispose();
+                    body.CollisionShape.Dispose();
+                }
+                obj.Dispose();
+            }
+            world.Dispose();
+            tierWorldInfo.Dispose();
+            softBodySolver.Dispose();
+            tierBroadphase.Dispose();
+            tierDispatcher.Dispose();
+            tierConf.Dispose();
+            tierWorldInfo = null;
+            tierBroadphase = null;
+            tierDispatcher = null;
+            tierConf = null;
+        }
+
+        // Steps until the body sleeps, returns false if it doesn't within maxSteps
+        static bool StepUntilSleeping(SoftRigidDynamicsWorld world, SoftBody softBody, int maxSteps)
+        {
+            for (int i = 0; i < maxSteps; i++)
+            {
+                world.StepSimulation(1.0f / 60.0f);
+                if (softBody.ActivationState == ActivationState.IslandSleeping)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void TestSleeping()
+        {
+            var softBodySolver = new DefaultSoftBodySolver();
+            softBodySolver.SleepingThreshold = 0.05f;
+            var world = CreateTierTestWorld(softBodySolver);
+            var patch = CreateTierTestPatch(world, 10);
+            var awakePatch = CreateTierTestPatch(world, 20);
+            awakePatch.ActivationState = ActivationState.DisableDeactivation;
+
+            if (!StepUntilSleeping(world, patch, 600))
+            {
+                Console.WriteLine("DefaultSoftBodySolver: settled patch didn't fall asleep!");
+            }
+
+            // A sleeping body isn't simulated
+            var positions = new Vector3[patch.Nodes.Count];
+            for (int i = 0; i < positions.Length; i++)
+            {
+                positions[i] = patch.Nodes[i].X;
+            }
+            for (int i = 0; i < 30; i++)
+            {
+                world.StepSimulation(1.0f / 60.0f);
+            }
+            for (int i = 0; i < positions.Length; i++)
+            {
+                if (patch.Nodes[i].X != positions[i])
+                {
+                    Console.WriteLine("DefaultSoftBodySolver: sleeping patch moved!");
+                    break;
+                }
+            }
+            if (awakePatch.ActivationState == ActivationState.IslandSleeping)
+            {
+                Console.WriteLine("DefaultSoftBodySolver: patch with DisableDeactivation fell asleep!");
+            }
+
+            patch.Activate();
+            world.StepSimulation(1.0f / 60.0f);
+            if (patch.ActivationState == ActivationState.IslandSleeping)
+            {
+                Console.WriteLine("DefaultSoftBodySolver: activated patch didn't wake up!");
+            }
+
+            DisposeTierTestWorld(world, softBodySolver);
+        }
+
+        void TestWakeByContact()
+        {
+            var softBodySolver = new DefaultSoftBodySolver();
+            softBodySolver.SleepingThreshold = 0.05f;
+            var world = CreateTierTestWorld(softBodySolver);
+            var patch = CreateTierTestPatch(world, 10);
+
+            if (!StepUntilSleeping(world, patch, 600))
+            {
+                Console.WriteLine("DefaultSoftBodySolver: settled patch didn't fall asleep!");
+            }
+
+            // Dropped onto the middle of the patch
+            CreateTierTestBox(world, 1, new Vector3(0.5f, 0.5f, 0.5f), new Vector3(0, 13, 0));
+            bool woken = false;
+            for (int i = 0; i < 120 && !woken; i++)
+            {
+                world.StepSimulation(1.0f / 60.0f);
+                woken = patch.ActivationState != ActivationState.IslandSleeping;
+            }
+            if (!woken)
+            {
+                Console.WriteLine("DefaultSoftBodySolver: falling box didn't wake the patch!");
+            }
+
+            DisposeTierTestWorld(world, softBodySolver);
+        }
+
+        void TestWakeByAnchor()
+        {
+            var softBodySolver = new DefaultSoftBodySolver();
+            softBodySolver.SleepingThreshold = 0.05f;
+            var world = CreateTierTestWorld(softBodySolver);
+            CreateTierTestBox(world, 0, new Vector3(20, 0.5f, 20), new Vector3(0, -2, 0));
+
+            // The middle node holds on to a box that rests on the ground
+            var patch = CreateTierTestPatch(world, 0);
+            var box = CreateTierTestBox(world, 1, new Vector3(0.5f, 0.5f, 0.5f), new Vector3(0, -1, 0));
+            int middleNode = patch.Nodes.Count / 2;
+            patch.AppendAnchor(middleNode, box, true);
+
+            if (!StepUntilSleeping(world, patch, 900))
+            {
+                Console.WriteLine("DefaultSoftBodySolver: patch anchored to a resting box didn't fall asleep!");
+            }
+
+            box.Activate();
+            box.ApplyCentralImpulse(new Vector3(5, 0, 0));
+            world.StepSimulation(1.0f / 60.0f);
+            if (patch.ActivationState == ActivationState.IslandSleeping)
+            {
+                Console.WriteLine("DefaultSoftBodySolver: moving anchored box didn't wake the patch!");
+            }
+
+            DisposeTierTestWorld(world, softBodySolver);
+        }
+
+        void TestReducedLod()
+        {
+            var softBodySolver = new DefaultSoftBodySolver();
+            softBodySolver.LodDistance = 20;
+            softBodySolver.LodViewerPosition = new Vector3(0, 10, 100);
+            var world = CreateTierTestWorld(softBodySolver);
+            var patch = CreateTierTestPatch(world, 10);
+            patch.GenerateClusters(8);
+
+            world.StepSimulation(1.0f / 60.0f);
+            if (!softBodySolver.IsReducedLod(patch))
+            {
+                Console.WriteLine("DefaultSoftBodySolver: distant patch wasn't reduced!");
+            }
+
+            // The full mesh follows the proxy, which sags under gravity
+            for (int i = 0; i < 60; i++)
+            {
+                world.StepSimulation(1.0f / 60.0f);
+            }
+            Vector3 middle = patch.Nodes[patch.Nodes.Count / 2].X;
+            if (!(middle.Y < 10 && middle.Y > 0))
+            {
+                Console.WriteLine("DefaultSoftBodySolver: reduced patch didn't follow its proxy!");
+            }
+
+            softBodySolver.LodViewerPosition = new Vector3(0, 10, 0);
+            world.StepSimulation(1.0f / 60.0f);
+            if (softBodySolver.IsReducedLod(patch))
+            {
+                Console.WriteLine("DefaultSoftBodySolver: nearby patch wasn't restored!");
+            }
+
+            // The state is dropped with the body, so a new body at the same address doesn't inherit it
+            softBodySolver.LodViewerPosition = new Vector3(0, 10, 100);
+            world.StepSimulation(1.0f / 60.0f);
+            world.RemoveSoftBody(patch);
+            if (softBodySolver.IsReducedLod(patch))
+            {
+                Console.WriteLine("DefaultSoftBodySolver: removed patch kept its reduced state!");
+            }
+            patch.Dispose();
+
+            DisposeTierTestWorld(world, softBodySolver);
+        }
+
+        void TestRayTestBatchThreads()
+        {
+            var collisionConf = new SoftBodyRigidBodyCollisionConfiguration();
+            var dispatcher = new CollisionDispatcher(collisionConf);
+            var broadphase = new DbvtBroadphase();
+            var softBodySolver = new DefaultSoftBodySolver();
+            var world = new SoftRigidDynamicsWorld(dispatcher, broadphase, null, collisionConf, softBodySolver);
+
+            var softBodyWorldInfo = new SoftBodyWorldInfo();
+            softBodyWorldInfo.Dispatcher = dispatcher;
+            softBodyWorldInfo.Broadphase = broadphase;
+            softBodyWorldInfo.SparseSdf.Initialize();
+
+            var patch = SoftBodyHelpers.CreatePatch(softBodyWorldInfo,
+                new Vector3(-5, 5, -5), new Vector3(5, 5, -5),
+                new Vector3(-5, 5, 5), new Vector3(5, 5, 5), 8, 8, 1 + 2 + 4 + 8, true);
+            world.AddSoftBody(patch);
+
+            var groundShape = new BoxShape(20, 1, 20);
+            var constInfo = new RigidBodyConstructionInfo(0, new DefaultMotionState(), groundShape, Vector3.Zero);
+            var ground = new RigidBody(constInfo);
+            world.AddRigidBody(ground);
+            world.StepSimulation(1.0f / 60.0f);
+
+            // Rays through the patch and past its edges onto the ground
+            const int gridSize = 16;
+            var rayFrom = new Vector3[gridSize * gridSize];
+            var rayTo = new Vector3[gridSize * gridSize];
+            for (int i = 0; i < rayFrom.Length; i++)
+            {
+                float x = (i % gridSize) - gridSize / 2 + 0.25f;
+                float z = (i / gridSize) - gridSize / 2 + 0.25f;
+                rayFrom[i] = new Vector3(x, 20, z);
+                rayTo[i] = new Vector3(x, -5, z);
+            }
+
+            var serial = new BatchQueryResults(2);
+            var threaded = new BatchQueryResults(2);
+            world.RayTestBatch(rayFrom, rayTo, null, null, serial, 1);
+            world.RayTestBatch(rayFrom, rayTo, null, null, threaded, 4);
+
+            bool match = true;
+            bool patchHit = false;
+            for (int i = 0; i < rayFrom.Length; i++)
+            {
+                if (serial.HitCounts[i] != threaded.HitCounts[i])
+                {
+                    match = false;
+                    break;
+                }
+                for (int j = 0; j < serial.HitCounts[i]; j++)
+                {
+                    int index = i * serial.MaxHitsPerQuery + j;
+                    if (serial.CollisionObjects[index] != threaded.CollisionObjects[index] ||
+                        serial.HitFractions[index] != threaded.HitFractions[index])
+                    {
+                        match = false;
+                    }
+                    if (serial.CollisionObjects[index] == patch)
+                    {
+                        patchHit = true;
+                    }
+                }
+            }
+            if (!match)
+            {
+                Console.WriteLine("RayTestBatch: NumThreads = 4 doesn't match NumThreads = 1!");
+            }
+            if (!patchHit)
+            {
+                Console.WriteLine("RayTestBatch: soft body not hit!");
+            }
+            serial.Dispose();
+            threaded.Dispose();
+
+            world.RemoveRigidBody(ground);
+            ground.Dispose();
+            constInfo.MotionState.Dispose();
+            constInfo.Dispose();
+            groundShape.Dispose();
+            world.RemoveSoftBody(patch);
+            patch.Dispose();
+
+            world.Dispose();
+            softBodyWorldInfo.Dispose();
+            softBodySolver.Dispose();
+            broadphase.Dispose();
+            dispatcher.Dispose();
+            collisionConf.Dispose();
+        }
+
+        void TestCulledDebugDraw()
+        {
+            var collisionConf = new SoftBodyRigidBodyCollisionConfiguration();
+            var dispatcher = new CollisionDispatcher(collisionConf);
+            var broadphase = new DbvtBroadphase();
+            var softBodySolver = new DefaultSoftBodySolver();
+            var world = new SoftRigidDynamicsWorld(dispatcher, broadphase, null, collisionConf, softBodySolver);
+
+            var softBodyWorldInfo = new SoftBodyWorldInfo();
+            softBodyWorldInfo.Dispatcher = dispatcher;
+            softBodyWorldInfo.Broadphase = broadphase;
+            softBodyWorldInfo.SparseSdf.Initialize();
+
+            var patch = SoftBodyHelpers.CreatePatch(softBodyWorldInfo,
+                new Vector3(-5, 5, -5), new Vector3(5, 5, -5),
+                new Vector3(-5, 5, 5), new Vector3(5, 5, 5), 8, 8, 1 + 2 + 4 + 8, true);
+            world.AddSoftBody(patch);
+            world.StepSimulation(1.0f / 60.0f);
+
+            var drawer = new BufferedDebugDraw();
+            drawer.DebugMode = DebugDrawModes.DrawWireframe;
+            world.DebugDrawer = drawer;
+
+            // The patch is the only object, everything drawn inside the frustum belongs to it
+            world.DebugDrawWorld(new[] { new Vector4(0, -1, 0, 10) });
+            if (drawer.LineVertexCount == 0)
+            {
+                Console.WriteLine("DebugDrawWorld: visible soft body not drawn!");
+            }
+
+            drawer.Clear();
+            world.DebugDrawWorld(new[] { new Vector4(0, -1, 0, 0) });
+            if (drawer.LineVertexCount != 0)
+            {
+                Console.WriteLine("DebugDrawWorld: culled soft body drawn!");
+            }
+
+            world.DebugDrawer = null;
+            drawer.Dispose();
+            world.RemoveSoftBody(patch);
+            patch.Dispose();
+
+            world.Dispose();
+            softBodyWorldInfo.Dispose();
+            softBodySolver.Dispose();
+            broadphase.Dispose();
+            dispatcher.Dispose();
+            collisionConf.Dispose();
         }
     }
 }